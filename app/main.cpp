@@ -0,0 +1,345 @@
+#include "process_stats.h"
+
+#include "common.h"
+#include "registry.h"
+#include "thread_pool.h"
+#include "timing.h"
+
+#include <chrono>
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <future>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+enum class Format
+{
+	text,
+	json
+};
+
+struct RunOptions
+{
+	int day = 0;
+	// 0 runs all parts of the day
+	int part = 0;
+	std::optional<std::filesystem::path> input;
+	int repeat = 1;
+	Format format = Format::text;
+	// Solve day 1 streaming from the file within this many bytes
+	std::optional<std::size_t> memory_budget;
+	// Options of the all command, 0 jobs uses all hardware threads
+	std::size_t jobs = 0;
+	std::optional<std::filesystem::path> input_dir;
+	// Also run the full input of parts marked slow
+	bool include_slow = false;
+};
+
+struct RunResult
+{
+	int day;
+	int part;
+	Answer answer;
+	utils::Stats parse_us;
+	utils::Stats solve_us;
+	// Heap allocations of one parse and one solve
+	std::size_t parse_allocations;
+	std::size_t solve_allocations;
+};
+
+// One solver run on one bundled input by the all command
+struct JobResult
+{
+	int day;
+	int part;
+	std::string_view input;
+	Answer answer;
+	std::optional<Answer> expected;
+	double time_ms;
+	std::size_t worker;
+};
+
+void print_usage()
+{
+	std::cerr << "Usage: aoc2024 run --day D [--part P] [--input PATH] [--repeat N] [--format text|json]\n"
+	          << "                   [--memory-budget BYTES]\n"
+	          << "       aoc2024 all [--jobs N] [--input-dir DIR] [--format text|json] [--include-slow]\n"
+	          << "  --day D          Day to run\n"
+	          << "  --part P         Part to run (default all parts of the day)\n"
+	          << "  --input PATH     Puzzle input (default <exe dir>/input/dayD.full.txt)\n"
+	          << "  --repeat N       Number of measured runs (default 1)\n"
+	          << "  --format F       text or json - one JSON object per line (default text)\n"
+	          << "  --memory-budget BYTES  Day 1 only, read the input in chunks and keep at most about BYTES of data\n"
+	          << "                   (the parse time is part of the solve time)\n"
+	          << "  --jobs N         Worker threads running the small and full input of every part (default all cores)\n"
+	          << "  --input-dir DIR  Directory with the dayN.small.txt and dayN.full.txt files (default <exe dir>/input)\n"
+	          << "  --include-slow   Also run the full input of parts which are very slow on it\n";
+}
+
+RunOptions parse_options(int argc, char** argv)
+{
+	RunOptions options;
+	for (int i = 2; i < argc; ++i) {
+		const std::string_view arg = argv[i];
+		if (arg == "--include-slow") {
+			options.include_slow = true;
+			continue;
+		}
+		if (i + 1 >= argc) {
+			throw std::invalid_argument(std::format("Missing value of {}", arg));
+		}
+		const std::string_view value = argv[++i];
+		if (arg == "--day") {
+			options.day = utils::to_int<int>(value);
+		}
+		else if (arg == "--part") {
+			options.part = utils::to_int<int>(value);
+		}
+		else if (arg == "--input") {
+			options.input = std::filesystem::path(value);
+		}
+		else if (arg == "--repeat") {
+			options.repeat = utils::to_int<int>(value);
+			if (options.repeat < 1) {
+				throw std::invalid_argument("--repeat must be at least 1");
+			}
+		}
+		else if (arg == "--memory-budget") {
+			options.memory_budget = utils::to_int<std::size_t>(value);
+		}
+		else if (arg == "--jobs") {
+			options.jobs = utils::to_int<std::size_t>(value);
+		}
+		else if (arg == "--input-dir") {
+			options.input_dir = std::filesystem::path(value);
+		}
+		else if (arg == "--format") {
+			if (value == "text") {
+				options.format = Format::text;
+			}
+			else if (value == "json") {
+				options.format = Format::json;
+			}
+			else {
+				throw std::invalid_argument(std::format("Unknown format {}", value));
+			}
+		}
+		else {
+			throw std::invalid_argument(std::format("Unknown option {}", arg));
+		}
+	}
+	return options;
+}
+
+template <typename Solver>
+RunResult run(const Solver& solver, std::string_view text, int repeat)
+{
+	RunResult result{solver.day, solver.part, 0, {}, {}, 0, 0};
+	std::vector<double> parse_times;
+	std::vector<double> solve_times;
+	for (int i = 0; i < repeat; ++i) {
+		const auto allocations_start = allocation_count();
+		const auto t0 = Clock::now();
+		auto input = solver.parse(text);
+		const auto t1 = Clock::now();
+		const auto allocations_parsed = allocation_count();
+		result.answer = solver.solve(std::move(input));
+		const auto t2 = Clock::now();
+		const auto allocations_solved = allocation_count();
+
+		parse_times.push_back(std::chrono::duration<double, std::micro>(t1 - t0).count());
+		solve_times.push_back(std::chrono::duration<double, std::micro>(t2 - t1).count());
+		result.parse_allocations = allocations_parsed - allocations_start;
+		result.solve_allocations = allocations_solved - allocations_parsed;
+	}
+	result.parse_us = utils::compute_stats(std::move(parse_times));
+	result.solve_us = utils::compute_stats(std::move(solve_times));
+	return result;
+}
+
+void print(const RunResult& result, int repeat, Format format)
+{
+	const auto rss = peak_rss_kb();
+	if (format == Format::json) {
+		std::cout << std::format(
+		    "{{\"day\":{},\"part\":{},\"answer\":{},\"repeat\":{},"
+		    "\"parse_us\":{{\"min\":{:.3f},\"median\":{:.3f},\"p99\":{:.3f}}},"
+		    "\"solve_us\":{{\"min\":{:.3f},\"median\":{:.3f},\"p99\":{:.3f}}},"
+		    "\"allocations\":{{\"parse\":{},\"solve\":{}}},\"peak_rss_kb\":{}}}\n",
+		    result.day, result.part, result.answer, repeat, result.parse_us.min, result.parse_us.median,
+		    result.parse_us.p99, result.solve_us.min, result.solve_us.median, result.solve_us.p99,
+		    result.parse_allocations, result.solve_allocations, rss);
+		return;
+	}
+	std::cout << std::format("Day {} part {}: {}\n", result.day, result.part, result.answer);
+	std::cout << std::format("  parse: min {:.1f} us, median {:.1f} us, p99 {:.1f} us, {} allocations\n",
+	                         result.parse_us.min, result.parse_us.median, result.parse_us.p99,
+	                         result.parse_allocations);
+	std::cout << std::format("  solve: min {:.1f} us, median {:.1f} us, p99 {:.1f} us, {} allocations\n",
+	                         result.solve_us.min, result.solve_us.median, result.solve_us.p99,
+	                         result.solve_allocations);
+	std::cout << std::format("  peak RSS: {} kB\n", rss);
+}
+
+RunResult run_streaming(int part, const std::filesystem::path& input_file, std::size_t memory_budget, int repeat)
+{
+	RunResult result{1, part, 0, {0, 0, 0}, {}, 0, 0};
+	std::vector<double> solve_times;
+	for (int i = 0; i < repeat; ++i) {
+		const auto allocations_start = allocation_count();
+		const auto start = Clock::now();
+		result.answer = solve_day1_streaming(part, input_file, memory_budget);
+		solve_times.push_back(std::chrono::duration<double, std::micro>(Clock::now() - start).count());
+		result.solve_allocations = allocation_count() - allocations_start;
+	}
+	result.solve_us = utils::compute_stats(std::move(solve_times));
+	return result;
+}
+
+int run_command(const RunOptions& options)
+{
+	if (options.day == 0) {
+		throw std::invalid_argument("--day is required");
+	}
+	const auto input_file =
+	    options.input.value_or(utils::abs_exe_directory() / "input" / std::format("day{}.full.txt", options.day));
+
+	if (options.memory_budget) {
+		if (options.day != 1) {
+			throw std::invalid_argument("--memory-budget is supported only by day 1");
+		}
+		for (const int part : {1, 2}) {
+			if (options.part == 0 || options.part == part) {
+				print(run_streaming(part, input_file, *options.memory_budget, options.repeat), options.repeat,
+				      options.format);
+			}
+		}
+		return 0;
+	}
+
+	const utils::MappedFile file(input_file);
+
+	bool found = false;
+	for_each_solver([&](const auto& solver) {
+		if (solver.day == options.day && (options.part == 0 || solver.part == options.part)) {
+			found = true;
+			print(run(solver, file.view(), options.repeat), options.repeat, options.format);
+		}
+	});
+	if (!found) {
+		throw std::logic_error(std::format("Unknown day {} part {}", options.day, options.part));
+	}
+	return 0;
+}
+
+template <typename Solver>
+JobResult run_job(const Solver& solver, const std::filesystem::path& input_dir, std::string_view input)
+{
+	const utils::MappedFile file(input_dir / std::format("day{}.{}.txt", solver.day, input));
+	const auto start = Clock::now();
+	const auto answer = solver.run(file.view());
+	const auto time_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	const auto expected = input == "small" ? solver.expected.small : solver.expected.full;
+	return {solver.day, solver.part, input, answer, expected, time_ms, 0};
+}
+
+void print(const JobResult& result, Format format)
+{
+	const bool ok = !result.expected || result.answer == *result.expected;
+	if (format == Format::json) {
+		std::cout << std::format(
+		    "{{\"day\":{},\"part\":{},\"input\":\"{}\",\"answer\":{},\"ok\":{},\"time_ms\":{:.3f},\"worker\":{}}}\n",
+		    result.day, result.part, result.input, result.answer, ok ? "true" : "false", result.time_ms,
+		    result.worker);
+		return;
+	}
+	std::cout << std::format("{:>4} {:>5}  {:<6}{:>20} {:>12.3f} {:>7}  {}\n", result.day, result.part, result.input,
+	                         result.answer, result.time_ms, result.worker, ok ? "ok" : "WRONG");
+}
+
+// Runs every part on the small and full input in parallel, returns 1 if an answer does not match the expected one
+int all_command(const RunOptions& options)
+{
+	const auto input_dir = options.input_dir.value_or(utils::abs_exe_directory() / "input");
+	const auto start = Clock::now();
+
+	std::vector<std::future<JobResult>> jobs;
+	std::size_t workers = 0;
+	std::size_t skipped = 0;
+	{
+		utils::ThreadPool pool(options.jobs);
+		workers = pool.size();
+		for_each_solver([&](const auto& solver) {
+			for (const std::string_view input : {"small", "full"}) {
+				// Slow parts would keep the command busy for a very long time
+				if (input == "full" && solver.slow && !options.include_slow) {
+					++skipped;
+					continue;
+				}
+				jobs.push_back(pool.submit([&solver, &pool, &input_dir, input] {
+					auto result = run_job(solver, input_dir, input);
+					result.worker = pool.worker_index();
+					return result;
+				}));
+			}
+		});
+	}
+	const auto wall_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+	if (options.format == Format::text) {
+		std::cout << std::format("{} jobs on {} workers\n", jobs.size(), workers);
+		std::cout << std::format("{:>4} {:>5}  {:<6}{:>20} {:>12} {:>7}\n", "Day", "Part", "Input", "Answer",
+		                         "Time ms", "Worker");
+	}
+
+	double total_ms = 0;
+	bool all_ok = true;
+	for (auto& job : jobs) {
+		const auto result = job.get();
+		total_ms += result.time_ms;
+		all_ok = all_ok && (!result.expected || result.answer == *result.expected);
+		print(result, options.format);
+	}
+
+	if (options.format == Format::json) {
+		std::cout << std::format(
+		    "{{\"jobs\":{},\"skipped\":{},\"workers\":{},\"wall_ms\":{:.3f},\"total_job_ms\":{:.3f}}}\n",
+		    jobs.size(), skipped, workers, wall_ms, total_ms);
+	}
+	else {
+		std::cout << std::format("Wall time {:.3f} ms, sum of job times {:.3f} ms\n", wall_ms, total_ms);
+		if (skipped != 0) {
+			std::cout << std::format("Skipped the full input of {} slow parts, run them with --include-slow\n",
+			                         skipped);
+		}
+	}
+	return all_ok ? 0 : 1;
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+	const std::string_view command = argc < 2 ? "" : argv[1];
+	if (command != "run" && command != "all") {
+		print_usage();
+		return 1;
+	}
+
+	try {
+		const auto options = parse_options(argc, argv);
+		return command == "run" ? run_command(options) : all_command(options);
+	}
+	catch (const std::exception& e) {
+		std::cerr << e.what() << '\n';
+		return 1;
+	}
+}
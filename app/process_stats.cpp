@@ -0,0 +1,136 @@
+#include "process_stats.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#if defined(_MSC_VER)
+#include <windows.h>
+#include <psapi.h>
+#pragma comment(lib, "psapi.lib")
+#else
+#include <sys/resource.h>
+#endif
+
+namespace
+{
+std::atomic<std::size_t> allocations{0};
+
+void* allocate(std::size_t size)
+{
+	allocations.fetch_add(1, std::memory_order_relaxed);
+	if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+		return ptr;
+	}
+	throw std::bad_alloc();
+}
+
+void* allocate_aligned(std::size_t size, std::align_val_t alignment)
+{
+	allocations.fetch_add(1, std::memory_order_relaxed);
+	const auto align = static_cast<std::size_t>(alignment);
+#if defined(_MSC_VER)
+	void* ptr = _aligned_malloc(size == 0 ? 1 : size, align);
+#else
+	// aligned_alloc requires the size to be a non-zero multiple of the alignment
+	void* ptr = std::aligned_alloc(align, std::max<std::size_t>((size + align - 1) / align * align, align));
+#endif
+	if (ptr) {
+		return ptr;
+	}
+	throw std::bad_alloc();
+}
+
+void deallocate_aligned(void* ptr) noexcept
+{
+#if defined(_MSC_VER)
+	_aligned_free(ptr);
+#else
+	std::free(ptr);
+#endif
+}
+}  // namespace
+
+void* operator new(std::size_t size)
+{
+	return allocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+	return allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+	return allocate_aligned(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+	return allocate_aligned(size, alignment);
+}
+
+void operator delete(void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+	deallocate_aligned(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept
+{
+	deallocate_aligned(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept
+{
+	deallocate_aligned(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept
+{
+	deallocate_aligned(ptr);
+}
+
+std::size_t allocation_count()
+{
+	return allocations.load(std::memory_order_relaxed);
+}
+
+std::size_t peak_rss_kb()
+{
+#if defined(_MSC_VER)
+	PROCESS_MEMORY_COUNTERS counters{};
+	GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters));
+	return counters.PeakWorkingSetSize / 1024;
+#else
+	rusage usage{};
+	getrusage(RUSAGE_SELF, &usage);
+	// Linux reports kilobytes, macOS bytes
+#if defined(__APPLE__)
+	return static_cast<std::size_t>(usage.ru_maxrss) / 1024;
+#else
+	return static_cast<std::size_t>(usage.ru_maxrss);
+#endif
+#endif
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <cstddef>
+
+// Number of heap allocations made by the process so far (counted by the replaced global operator new)
+std::size_t allocation_count();
+
+// Peak resident set size of the process in kilobytes
+std::size_t peak_rss_kb();
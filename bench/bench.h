@@ -0,0 +1,62 @@
+#pragma once
+
+#include "timing.h"
+
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct BenchOptions
+{
+	int warmup = 3;
+	int iterations = 20;
+	// Benchmark only the given day, 0 for all days
+	int only_day = 0;
+	// Include solvers which are very slow on the full input
+	bool run_slow = false;
+	std::filesystem::path input_dir;
+	// Size of the synthetic data used by the micro benchmarks
+	std::size_t data_mb = 64;
+	// Highest thread count of the scaling benchmark, 0 for all cores
+	std::size_t max_threads = 0;
+};
+
+// Runs the function warmup + iterations times, returns the wall time of the measured runs in seconds
+template <typename Function>
+std::vector<double> time_runs(const BenchOptions& options, Function&& function)
+{
+	using Clock = std::chrono::steady_clock;
+	for (int i = 0; i < options.warmup; ++i) {
+		function();
+	}
+	std::vector<double> times;
+	times.reserve(options.iterations);
+	for (int i = 0; i < options.iterations; ++i) {
+		const auto start = Clock::now();
+		function();
+		times.push_back(std::chrono::duration<double>(Clock::now() - start).count());
+	}
+	return times;
+}
+
+// Keeps the compiler from optimizing away a computed value
+template <typename T>
+void do_not_optimize(const T& value)
+{
+#if defined(_MSC_VER)
+	static volatile const T* sink;
+	sink = &value;
+#else
+	asm volatile("" : : "g"(&value) : "memory");
+#endif
+}
+
+void bench_solvers(const BenchOptions& options);
+void bench_scanner(const BenchOptions& options);
+void bench_scaling(const BenchOptions& options);
+void bench_sort(const BenchOptions& options);
+void bench_grammar(const BenchOptions& options);
+void bench_word_search(const BenchOptions& options);
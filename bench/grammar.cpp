@@ -0,0 +1,47 @@
+#include "bench.h"
+#include "inputs.h"
+
+#include "common.h"
+#include "scheduler.h"
+#include "solvers.h"
+
+#include <cstdint>
+#include <format>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+namespace
+{
+// Median throughput in GB/s of solving day 3 on the memory
+template <typename Solve>
+double scan_rate(const BenchOptions& options, std::string_view memory, int part, Solve&& solve)
+{
+	const auto stats = utils::compute_stats(time_runs(options, [&] { do_not_optimize(solve(part, memory)); }));
+	return static_cast<double>(memory.size()) / 1e9 / stats.median;
+}
+
+void compare(const BenchOptions& options, std::string_view name, std::string_view memory)
+{
+	for (const int part : {1, 2}) {
+		const auto hand_written = scan_rate(options, memory, part, [](int part, std::string_view memory) {
+			return solve_day3(part, memory);
+		});
+		const auto grammar = scan_rate(options, memory, part, solve_day3_grammar);
+		std::cout << std::format("{:<16} {:>4} | {:>12.3f} {:>12.3f} | {:>6.2f}x\n", name, part, hand_written, grammar,
+		                         grammar / hand_written);
+	}
+}
+}  // namespace
+
+void bench_grammar(const BenchOptions& options)
+{
+	std::cout << "Day 3 instruction matching - one thread, median throughput in GB/s\n";
+	std::cout << std::format("{:<16} {:>4} | {:>12} {:>12} | {:>7}\n", "memory", "part", "hand written", "grammar",
+	                         "ratio");
+	utils::set_default_threads(1);
+	const utils::MappedFile file(options.input_dir / "day3.full.txt");
+	compare(options, "puzzle input", file.view());
+	compare(options, std::format("synthetic {} MB", options.data_mb), make_memory(options.data_mb << 20));
+	utils::set_default_threads(0);
+}
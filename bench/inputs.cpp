@@ -0,0 +1,74 @@
+#include "inputs.h"
+
+#include <cmath>
+#include <format>
+#include <random>
+#include <string_view>
+
+std::string make_columns(std::size_t size)
+{
+	std::mt19937 rng(2024);
+	std::uniform_int_distribution<int> dist(10'000, 99'999);
+	std::string text;
+	text.reserve(size + 32);
+	while (text.size() < size) {
+		text += std::to_string(dist(rng));
+		text += "   ";
+		text += std::to_string(dist(rng));
+		text += '\n';
+	}
+	return text;
+}
+
+std::string make_reports(std::size_t size)
+{
+	std::mt19937 rng(2024);
+	std::string text;
+	text.reserve(size + 64);
+	while (text.size() < size) {
+		int level = 10 + static_cast<int>(rng() % 80);
+		const int levels = 5 + static_cast<int>(rng() % 4);
+		for (int i = 0; i < levels; ++i) {
+			level += static_cast<int>(rng() % 7) - 3;
+			text += std::to_string(level);
+			text += i + 1 < levels ? ' ' : '\n';
+		}
+	}
+	return text;
+}
+
+std::string make_memory(std::size_t size)
+{
+	constexpr std::string_view junk = "xmu(d!o)[]{ ,";
+	std::mt19937 rng(2024);
+	std::string memory;
+	memory.reserve(size + 64);
+	while (memory.size() < size) {
+		switch (rng() % 10) {
+		case 0:
+			memory += std::format("mul({},{})", rng() % 1000, rng() % 1000);
+			break;
+		case 1:
+			memory += rng() % 2 == 0 ? "do()" : "don't()";
+			break;
+		default:
+			memory += junk[rng() % junk.size()];
+		}
+	}
+	return memory;
+}
+
+std::string make_word_grid(std::size_t size)
+{
+	const auto side = static_cast<std::size_t>(std::sqrt(static_cast<double>(size)));
+	std::mt19937 rng(2024);
+	std::string text;
+	text.reserve(side * (side + 1));
+	for (std::size_t row = 0; row < side; ++row) {
+		for (std::size_t col = 0; col < side; ++col) {
+			text += "XMAS"[rng() % 4];
+		}
+		text += '\n';
+	}
+	return text;
+}
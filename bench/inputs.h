@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+// Synthetic puzzle inputs of about size bytes for the micro and scaling benchmarks, the same for every run
+
+// Two columns of numbers in the layout of the day 1 input
+std::string make_columns(std::size_t size);
+// Day 2 reports of 5 to 8 levels
+std::string make_reports(std::size_t size);
+// Day 3 memory, junk with an instruction every few bytes
+std::string make_memory(std::size_t size);
+// Square day 4 grid of random letters X, M, A and S
+std::string make_word_grid(std::size_t size);
@@ -0,0 +1,83 @@
+#include "bench.h"
+
+#include "common.h"
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+static void print_usage()
+{
+	std::cout << "Usage: aoc2024_bench [--suite NAME] [--warmup N] [--iterations M] [--day D] [--input-dir DIR] [--all]\n"
+	          << "                     [--data-mb MB] [--threads N]\n"
+	          << "  --suite NAME    solvers, scanner, scaling, sort, grammar, words or all (default all)\n"
+	          << "  --warmup N      Number of unmeasured runs before measuring (default 3)\n"
+	          << "  --iterations M  Number of measured runs (default 20)\n"
+	          << "  --day D         Benchmark only the given day\n"
+	          << "  --input-dir DIR Directory with dayN.full.txt files (default <exe dir>/input)\n"
+	          << "  --all           Include solvers which are very slow on the full input\n"
+	          << "  --data-mb MB    Size of the synthetic data of the micro benchmarks (default 64)\n"
+	          << "  --threads N     Highest thread count of the scaling benchmark (default all cores)\n";
+}
+
+int main(int argc, char** argv)
+{
+	BenchOptions options;
+	options.input_dir = utils::abs_exe_directory() / "input";
+	std::string suite = "all";
+
+	for (int i = 1; i < argc; ++i) {
+		const std::string_view arg = argv[i];
+		const bool has_value = i + 1 < argc;
+		if (arg == "--suite" && has_value) {
+			suite = argv[++i];
+		}
+		else if (arg == "--warmup" && has_value) {
+			options.warmup = std::stoi(argv[++i]);
+		}
+		else if (arg == "--iterations" && has_value) {
+			options.iterations = std::max(1, std::stoi(argv[++i]));
+		}
+		else if (arg == "--day" && has_value) {
+			options.only_day = std::stoi(argv[++i]);
+		}
+		else if (arg == "--input-dir" && has_value) {
+			options.input_dir = argv[++i];
+		}
+		else if (arg == "--all") {
+			options.run_slow = true;
+		}
+		else if (arg == "--data-mb" && has_value) {
+			options.data_mb = std::max(1, std::stoi(argv[++i]));
+		}
+		else if (arg == "--threads" && has_value) {
+			options.max_threads = std::max(1, std::stoi(argv[++i]));
+		}
+		else {
+			print_usage();
+			return arg == "--help" ? 0 : 1;
+		}
+	}
+
+	const bool all = suite == "all";
+	if (all || suite == "solvers") {
+		bench_solvers(options);
+	}
+	if (all || suite == "scanner") {
+		bench_scanner(options);
+	}
+	if (all || suite == "scaling") {
+		bench_scaling(options);
+	}
+	if (all || suite == "sort") {
+		bench_sort(options);
+	}
+	if (all || suite == "grammar") {
+		bench_grammar(options);
+	}
+	if (all || suite == "words") {
+		bench_word_search(options);
+	}
+	return 0;
+}
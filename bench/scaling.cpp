@@ -0,0 +1,123 @@
+#include "bench.h"
+#include "inputs.h"
+
+#include "common.h"
+#include "registry.h"
+#include "scheduler.h"
+#include "solvers.h"
+
+#include <algorithm>
+#include <array>
+#include <exception>
+#include <format>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+// Parts whose solve step runs on utils::parallel_for / parallel_reduce
+constexpr std::array<std::pair<int, int>, 11> parallel_parts{
+    {{2, 1}, {2, 2}, {3, 1}, {3, 2}, {4, 1}, {4, 2}, {6, 2}, {7, 1}, {7, 2}, {10, 1}, {10, 2}}};
+
+// 1, 2, 4, ... threads up to and including the maximum
+std::vector<std::size_t> thread_counts(std::size_t max_threads)
+{
+	std::vector<std::size_t> counts;
+	for (std::size_t threads = 1; threads < max_threads; threads *= 2) {
+		counts.push_back(threads);
+	}
+	counts.push_back(max_threads);
+	return counts;
+}
+
+// Median run time in milliseconds of the function for every thread count
+template <typename Function>
+std::vector<double> scale(const BenchOptions& options, const std::vector<std::size_t>& counts, Function&& function)
+{
+	std::vector<double> medians;
+	for (const auto threads : counts) {
+		utils::set_default_threads(threads);
+		auto times = time_runs(options, [&] { do_not_optimize(function()); });
+		medians.push_back(utils::compute_stats(std::move(times)).median * 1000);
+	}
+	return medians;
+}
+
+// Median solve time of every thread count, the input is parsed once
+template <typename Solver>
+std::vector<double> scale_solver(const BenchOptions& options, const Solver& solver, const std::vector<std::size_t>& counts)
+{
+	const utils::MappedFile file(options.input_dir / std::format("day{}.full.txt", solver.day));
+	const auto input = solver.parse(file.view());
+	return scale(options, counts, [&] { return solver.solve(input); });
+}
+
+void print_medians(std::string_view name, const std::vector<double>& medians)
+{
+	std::string line = std::format("{:>8} |", name);
+	for (const auto median : medians) {
+		line += std::format(" {:>9.3f}", median);
+	}
+	std::cout << line << std::format(" | {:>6.2f}x\n", medians.front() / medians.back());
+}
+}  // namespace
+
+void bench_scaling(const BenchOptions& options)
+{
+	const auto max_threads = options.max_threads != 0 ? options.max_threads : std::thread::hardware_concurrency();
+	const auto counts = thread_counts(std::max<std::size_t>(max_threads, 1));
+	std::cout << std::format("Scaling - warmup: {}, iterations: {}, median solve time in milliseconds per thread count\n",
+	                         options.warmup, options.iterations);
+	std::string header = std::format("{:>8} |", "day part");
+	for (const auto threads : counts) {
+		header += std::format(" {:>9}", std::format("{} thr", threads));
+	}
+	std::cout << header << " | speedup\n";
+
+	for (const auto& [day, part] : parallel_parts) {
+		if (options.only_day != 0 && day != options.only_day) {
+			continue;
+		}
+		visit_solver(day, part, [&](const auto& solver) {
+			if (solver.slow && !options.run_slow) {
+				return;
+			}
+			try {
+				print_medians(std::format("{} {}", day, part), scale_solver(options, solver, counts));
+			}
+			catch (const std::exception& e) {
+				std::cout << std::format("{:>8} | failed: {}\n", std::format("{} {}", day, part), e.what());
+			}
+		});
+	}
+
+	// Day 2 parsed and solved in one pass over data_mb of synthetic reports
+	if (options.only_day == 0 || options.only_day == 2) {
+		const auto reports = make_reports(options.data_mb << 20);
+		for (const int part : {1, 2}) {
+			print_medians(std::format("2 {} text", part),
+			              scale(options, counts, [&] { return solve_day2(part, std::string_view(reports)); }));
+		}
+	}
+	// Day 3 over data_mb of synthetic memory
+	if (options.only_day == 0 || options.only_day == 3) {
+		const auto memory = make_memory(options.data_mb << 20);
+		for (const int part : {1, 2}) {
+			print_medians(std::format("3 {} text", part),
+			              scale(options, counts, [&] { return solve_day3(part, std::string_view(memory)); }));
+		}
+	}
+	// Day 4 on a grid of data_mb cells
+	if (options.only_day == 0 || options.only_day == 4) {
+		const auto grid = parse_day4(make_word_grid(options.data_mb << 20));
+		for (const int part : {1, 2}) {
+			print_medians(std::format("4 {} grid", part),
+			              scale(options, counts, [&] { return solve_day4(part, grid); }));
+		}
+	}
+	utils::set_default_threads(0);
+}
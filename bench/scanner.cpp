@@ -0,0 +1,76 @@
+#include "bench.h"
+#include "inputs.h"
+
+#include "scanner.h"
+
+#include <charconv>
+#include <cstdint>
+#include <format>
+#include <iostream>
+#include <span>
+#include <spanstream>
+#include <string>
+#include <string_view>
+
+namespace
+{
+std::int64_t sum_scanner(std::string_view text)
+{
+	utils::IntScanner scanner(text);
+	std::int64_t sum = 0;
+	for (int value; scanner.next(value);) {
+		sum += value;
+	}
+	return sum;
+}
+
+std::int64_t sum_from_chars(std::string_view text)
+{
+	const char* first = text.data();
+	const char* last = first + text.size();
+	std::int64_t sum = 0;
+	while (first != last) {
+		if (*first < '0' || *first > '9') {
+			++first;
+			continue;
+		}
+		int value = 0;
+		first = std::from_chars(first, last, value).ptr;
+		sum += value;
+	}
+	return sum;
+}
+
+std::int64_t sum_istream(std::string_view text)
+{
+	std::ispanstream istream(std::span<const char>(text.data(), text.size()));
+	std::int64_t sum = 0;
+	for (int value; istream >> value;) {
+		sum += value;
+	}
+	return sum;
+}
+
+template <typename Function>
+void report(const BenchOptions& options, std::string_view name, std::string_view text, Function&& function)
+{
+	std::int64_t sum = 0;
+	const auto stats = utils::compute_stats(time_runs(options, [&] {
+		sum = function(text);
+		do_not_optimize(sum);
+	}));
+	const auto gb = static_cast<double>(text.size()) / 1e9;
+	std::cout << std::format("{:<12} | {:>10.3f} {:>10.3f} {:>10.3f} | {:>18}\n", name, gb / stats.median,
+	                         gb / stats.p99, gb / stats.min, sum);
+}
+}  // namespace
+
+void bench_scanner(const BenchOptions& options)
+{
+	const auto text = make_columns(options.data_mb << 20);
+	std::cout << std::format("Integer scanner - {} MB of two column data, throughput in GB/s\n", options.data_mb);
+	std::cout << std::format("{:<12} | {:>10} {:>10} {:>10} | {:>18}\n", "parser", "median", "p99", "best", "sum");
+	report(options, "IntScanner", text, sum_scanner);
+	report(options, "from_chars", text, sum_from_chars);
+	report(options, "istream", text, sum_istream);
+}
@@ -0,0 +1,82 @@
+#include "bench.h"
+
+#include "common.h"
+#include "registry.h"
+
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <format>
+#include <iostream>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+struct Sample
+{
+	double parse_us;
+	double solve_us;
+};
+
+template <typename Solver>
+Answer measure(const Solver& solver, std::string_view text, Sample& sample)
+{
+	const auto t0 = Clock::now();
+	auto input = solver.parse(text);
+	const auto t1 = Clock::now();
+	const Answer answer = solver.solve(std::move(input));
+	const auto t2 = Clock::now();
+	sample.parse_us = std::chrono::duration<double, std::micro>(t1 - t0).count();
+	sample.solve_us = std::chrono::duration<double, std::micro>(t2 - t1).count();
+	return answer;
+}
+
+template <typename Solver>
+void bench_solver(const BenchOptions& options, const Solver& solver)
+{
+	if ((options.only_day != 0 && solver.day != options.only_day) || (solver.slow && !options.run_slow)) {
+		return;
+	}
+	const auto input_file = options.input_dir / std::format("day{}.full.txt", solver.day);
+	Sample sample{};
+	Answer answer = 0;
+	std::vector<double> parse_times;
+	std::vector<double> solve_times;
+	parse_times.reserve(options.iterations);
+	solve_times.reserve(options.iterations);
+	try {
+		const utils::MappedFile file(input_file);
+		for (int i = 0; i < options.warmup; ++i) {
+			answer = measure(solver, file.view(), sample);
+		}
+		for (int i = 0; i < options.iterations; ++i) {
+			answer = measure(solver, file.view(), sample);
+			parse_times.push_back(sample.parse_us);
+			solve_times.push_back(sample.solve_us);
+		}
+	}
+	catch (const std::exception& e) {
+		std::cout << std::format("{:>3} {:>4} | failed: {}\n", solver.day, solver.part, e.what());
+		return;
+	}
+
+	const auto parse = utils::compute_stats(std::move(parse_times));
+	const auto solve = utils::compute_stats(std::move(solve_times));
+	std::cout << std::format("{:>3} {:>4} | {:>10.1f} {:>10.1f} {:>10.1f} | {:>10.1f} {:>10.1f} {:>10.1f} | {:>18}\n",
+	                         solver.day, solver.part, parse.min, parse.median, parse.p99, solve.min, solve.median,
+	                         solve.p99, answer);
+}
+}  // namespace
+
+void bench_solvers(const BenchOptions& options)
+{
+	std::cout << std::format("Solvers - warmup: {}, iterations: {}, times in microseconds, parsing from mapped input\n",
+	                         options.warmup, options.iterations);
+	std::cout << std::format("{:>3} {:>4} | {:>10} {:>10} {:>10} | {:>10} {:>10} {:>10} | {:>18}\n", "day", "part",
+	                         "parse min", "parse med", "parse p99", "solve min", "solve med", "solve p99", "answer");
+
+	for_each_solver([&](const auto& solver) { bench_solver(options, solver); });
+}
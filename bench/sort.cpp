@@ -0,0 +1,68 @@
+#include "bench.h"
+
+#include "radix_sort.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <format>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+template <typename T>
+std::vector<T> make_keys(std::size_t count, T min, T max)
+{
+	std::mt19937_64 rng(2024);
+	std::uniform_int_distribution<T> dist(min, max);
+	std::vector<T> keys(count);
+	std::ranges::generate(keys, [&] { return dist(rng); });
+	return keys;
+}
+
+// Median throughput in millions of keys per second, every run sorts a fresh copy of the keys
+template <typename T, typename Sort>
+double sort_rate(const BenchOptions& options, const std::vector<T>& keys, Sort&& sort)
+{
+	std::vector<T> work(keys.size());
+	const auto stats = utils::compute_stats(time_runs(options, [&] {
+		std::ranges::copy(keys, work.begin());
+		sort(work);
+		do_not_optimize(work.front());
+	}));
+	return static_cast<double>(keys.size()) / 1e6 / stats.median;
+}
+
+template <typename T>
+void compare(const BenchOptions& options, std::string_view name, std::size_t count, T min, T max)
+{
+	const auto keys = make_keys(count, min, max);
+	std::vector<T> scratch;
+	const auto std_rate = sort_rate(options, keys, [](std::vector<T>& work) { std::ranges::sort(work); });
+	const auto radix_rate =
+	    sort_rate(options, keys, [&](std::vector<T>& work) { utils::radix_sort(std::span(work), scratch); });
+	std::cout << std::format("{:<16} {:>10} | {:>12.1f} {:>12.1f} | {:>6.2f}x\n", name, count, std_rate, radix_rate,
+	                         radix_rate / std_rate);
+}
+}  // namespace
+
+void bench_sort(const BenchOptions& options)
+{
+	std::cout << "Sorting - median throughput in millions of keys per second\n";
+	std::cout << std::format("{:<16} {:>10} | {:>12} {:>12} | {:>7}\n", "keys", "count", "ranges::sort", "radix_sort",
+	                         "speedup");
+	// The largest size holds data_mb of 32 bit keys
+	const auto largest = (options.data_mb << 20) / sizeof(std::int32_t);
+	for (const std::size_t count :
+	     {std::size_t{256}, utils::radix_sort_min_size / 2, utils::radix_sort_min_size, std::size_t{1} << 16, largest}) {
+		compare<std::int32_t>(options, "int32 5 digits", count, 10'000, 99'999);
+		compare<std::int32_t>(options, "int32 full", count, std::numeric_limits<std::int32_t>::min(),
+		                      std::numeric_limits<std::int32_t>::max());
+		compare<std::int64_t>(options, "int64 full", count, std::numeric_limits<std::int64_t>::min(),
+		                      std::numeric_limits<std::int64_t>::max());
+	}
+}
@@ -0,0 +1,67 @@
+#include "bench.h"
+
+#include "grid.h"
+#include "word_search.h"
+
+#include <cmath>
+#include <cstdint>
+#include <format>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+// Square grid of about size random letters A to D
+utils::Grid<char> make_grid(std::size_t size)
+{
+	const auto side = static_cast<std::size_t>(std::sqrt(static_cast<double>(size)));
+	std::mt19937 rng(2024);
+	utils::Grid<char> grid(side, side);
+	for (std::size_t row = 0; row < side; ++row) {
+		for (auto& cell : grid.row(row)) {
+			cell = static_cast<char>('A' + rng() % 4);
+		}
+	}
+	return grid;
+}
+
+// Random words of 3 to 8 letters A to D
+std::vector<std::string> make_words(std::size_t count)
+{
+	std::mt19937 rng(count);
+	std::vector<std::string> words(count);
+	for (auto& word : words) {
+		word.resize(3 + rng() % 6);
+		for (auto& c : word) {
+			c = static_cast<char>('A' + rng() % 4);
+		}
+	}
+	return words;
+}
+}  // namespace
+
+void bench_word_search(const BenchOptions& options)
+{
+	const auto grid = make_grid(options.data_mb << 20);
+	std::cout << std::format("Word search - {}x{} grid, median throughput in million cells per second (8 directions)\n",
+	                         grid.rows(), grid.cols());
+	std::cout << std::format("{:>8} | {:>12} | {:>16}\n", "words", "cells/s", "occurrences");
+	for (const std::size_t count : {1, 16, 256, 4096}) {
+		const auto words = make_words(count);
+		const std::vector<std::string_view> views(words.begin(), words.end());
+		const utils::WordSearch search(views);
+		std::int64_t occurrences = 0;
+		const auto stats = utils::compute_stats(time_runs(options, [&] {
+			occurrences = 0;
+			for (const auto found : search.count(grid)) {
+				occurrences += found;
+			}
+			do_not_optimize(occurrences);
+		}));
+		const auto cells = static_cast<double>(grid.rows() * grid.cols());
+		std::cout << std::format("{:>8} | {:>12.1f} | {:>16}\n", count, cells / 1e6 / stats.median, occurrences);
+	}
+}
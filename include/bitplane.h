@@ -0,0 +1,65 @@
+#pragma once
+
+#include "grid.h"
+#include "simd.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace utils
+{
+// One bit per cell of a character grid, set where the cell holds the letter. Every row is stored as 64 bit words,
+// bit i of word w is column 64 * w + i, with a zero word before and after the row so that shifted reads at the
+// row ends need no checks.
+class BitPlane
+{
+public:
+	BitPlane() = default;
+	BitPlane(const Grid<char>& grid, char letter)
+	    : BitPlane(grid, letter, 0, grid.rows())
+	{
+	}
+	// Plane of the grid rows [first_row, last_row) only, row 0 of the plane is first_row of the grid
+	BitPlane(const Grid<char>& grid, char letter, std::size_t first_row, std::size_t last_row)
+	    : m_rows(last_row - first_row)
+	    , m_words((grid.cols() + 63) / 64)
+	    , m_bits(m_rows * (m_words + 2), 0)
+	{
+		for (std::size_t row = 0; row < m_rows; ++row) {
+			const auto cells = grid.row(first_row + row);
+			const std::string_view text(cells.data(), cells.size());
+			auto* bits = &m_bits[row * (m_words + 2) + 1];
+			for (std::size_t word = 0; word < m_words; ++word) {
+				bits[word] = byte_mask(text.substr(word * 64, 64), letter, letter);
+			}
+		}
+	}
+
+	std::size_t rows() const { return m_rows; }
+	// Words of a row without the padding
+	std::size_t words() const { return m_words; }
+
+	// Bits of the columns 64 * word + shift to 64 * word + shift + 63 of the row, shift is in (-64, 64). Columns
+	// outside of the grid read as 0.
+	std::uint64_t bits(std::size_t row, std::size_t word, int shift) const
+	{
+		const auto* bits = &m_bits[row * (m_words + 2) + 1 + word];
+		if (shift > 0) {
+			return bits[0] >> shift | bits[1] << (64 - shift);
+		}
+		if (shift < 0) {
+			return bits[0] << -shift | bits[-1] >> (64 + shift);
+		}
+		return bits[0];
+	}
+
+private:
+	std::size_t m_rows = 0;
+	std::size_t m_words = 0;
+	std::vector<std::uint64_t> m_bits;
+};
+
+}  // namespace utils
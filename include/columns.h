@@ -0,0 +1,141 @@
+#pragma once
+
+#include "common.h"
+#include "scanner.h"
+#include "scheduler.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <filesystem>
+#include <format>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+namespace utils
+{
+// Table of N integer columns stored as structure of arrays, one contiguous vector per column
+template <ScannableInt T, std::size_t N>
+class Columns
+{
+	static_assert(N > 0, "At least one column");
+
+public:
+	std::size_t rows() const { return m_columns[0].size(); }
+	void resize(std::size_t rows)
+	{
+		for (auto& column : m_columns) {
+			column.resize(rows);
+		}
+	}
+
+	std::vector<T>& operator[](std::size_t col) { return m_columns[col]; }
+	const std::vector<T>& operator[](std::size_t col) const { return m_columns[col]; }
+
+private:
+	std::array<std::vector<T>, N> m_columns;
+};
+
+namespace detail
+{
+// Number of lines of the text, counting an unterminated last line
+inline std::size_t count_lines(std::string_view text)
+{
+	const auto breaks = static_cast<std::size_t>(std::ranges::count(text, '\n'));
+	return breaks + (!text.empty() && text.back() != '\n' ? 1 : 0);
+}
+
+// Parses lines of exactly N numbers into rows [first_row, last_row) of the columns, one row per line, and returns
+// the number of parsed rows. Lines of only whitespace are skipped. The text starts at line first_row of the input,
+// which numbers the lines in the errors.
+template <ScannableInt T, std::size_t N>
+std::size_t parse_column_rows(std::string_view text, Columns<T, N>& columns, std::size_t first_row, std::size_t last_row)
+{
+	std::size_t row = first_row;
+	std::size_t line_number = first_row;
+	for (const auto line : lines(text)) {
+		++line_number;
+		if (line.find_first_not_of(" \t\r") == std::string_view::npos) {
+			continue;
+		}
+		if (row == last_row) {
+			throw std::logic_error(std::format("More lines than counted at line {}", line_number));
+		}
+		IntScanner scanner(line);
+		std::size_t col = 0;
+		for (T value; col < N && scanner.next(value); ++col) {
+			columns[col][row] = value;
+		}
+		if (T value; col < N || scanner.next(value)) {
+			throw std::invalid_argument(std::format("Line {} does not have {} numbers", line_number, N));
+		}
+		++row;
+	}
+	return row - first_row;
+}
+}  // namespace detail
+
+// Loads lines of N whitespace separated numbers into columns. The lines are counted first, so every column is
+// allocated once. Empty lines are skipped.
+template <ScannableInt T, std::size_t N>
+Columns<T, N> load_columns(std::string_view text)
+{
+	Columns<T, N> columns;
+	columns.resize(detail::count_lines(text));
+	columns.resize(detail::parse_column_rows(text, columns, 0, columns.rows()));
+	return columns;
+}
+
+// Parallel version of load_columns, the text is split at line breaks into pieces parsed by the threads of the
+// scheduler. Texts too short to be worth splitting are parsed by the calling thread.
+template <ScannableInt T, std::size_t N>
+Columns<T, N> load_columns(std::string_view text, Scheduler& scheduler)
+{
+	const auto pieces = std::clamp<std::size_t>(text.size() / parallel_parse_min_bytes, 1, scheduler.size());
+	if (pieces == 1) {
+		return load_columns<T, N>(text);
+	}
+
+	std::vector<std::string_view> chunks(pieces);
+	for (std::size_t piece = 0; piece < pieces; ++piece) {
+		chunks[piece] = line_chunk(text, piece, pieces);
+	}
+
+	// Every piece gets the rows of its lines, rows of empty lines are removed at the end
+	std::vector<std::size_t> first_rows(chunks.size() + 1, 0);
+	scheduler.parallel_for(0, chunks.size(), 1,
+	                       [&](std::size_t idx) { first_rows[idx + 1] = detail::count_lines(chunks[idx]); });
+	for (std::size_t idx = 0; idx < chunks.size(); ++idx) {
+		first_rows[idx + 1] += first_rows[idx];
+	}
+	Columns<T, N> columns;
+	columns.resize(first_rows.back());
+	std::vector<std::size_t> parsed(chunks.size());
+	scheduler.parallel_for(0, chunks.size(), 1, [&](std::size_t idx) {
+		parsed[idx] = detail::parse_column_rows(chunks[idx], columns, first_rows[idx], first_rows[idx + 1]);
+	});
+
+	std::size_t rows = parsed[0];
+	for (std::size_t idx = 1; idx < chunks.size(); ++idx) {
+		if (rows != first_rows[idx]) {
+			for (std::size_t col = 0; col < N; ++col) {
+				const auto first = columns[col].begin() + static_cast<std::ptrdiff_t>(first_rows[idx]);
+				std::copy(first, first + static_cast<std::ptrdiff_t>(parsed[idx]),
+				          columns[col].begin() + static_cast<std::ptrdiff_t>(rows));
+			}
+		}
+		rows += parsed[idx];
+	}
+	columns.resize(rows);
+	return columns;
+}
+
+template <ScannableInt T, std::size_t N>
+Columns<T, N> load_columns(const std::filesystem::path& file_path)
+{
+	const MappedFile file(file_path);
+	return load_columns<T, N>(file.view());
+}
+
+}  // namespace utils
@@ -1,29 +1,194 @@
 #pragma once
 
+#include "scanner.h"
+
+#include <algorithm>
+#include <cstddef>
 #include <filesystem>
 #include <fstream>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <spanstream>
+#include <string>
+#include <string_view>
 #include <vector>
 
 namespace utils
 {
 std::filesystem::path abs_exe_directory();
-void load_columns(std::vector<int>& col1, std::vector<int>& col2, const std::filesystem::path& file_path);
+
+// Forward iterator over the lines of a text. Lines are views into the text, line terminators ("\n" or "\r\n")
+// are not part of them. Text ending with a line terminator does not produce an empty last line.
+class LineIterator
+{
+public:
+	using iterator_category = std::forward_iterator_tag;
+	using value_type = std::string_view;
+	using difference_type = std::ptrdiff_t;
+
+	LineIterator() = default;
+	explicit LineIterator(std::string_view text)
+	    : m_rest(text)
+	{
+		advance();
+	}
+
+	std::string_view operator*() const { return m_line; }
+	LineIterator& operator++()
+	{
+		advance();
+		return *this;
+	}
+	LineIterator operator++(int)
+	{
+		auto tmp = *this;
+		advance();
+		return tmp;
+	}
+	bool operator==(const LineIterator& other) const
+	{
+		return m_end == other.m_end && (m_end || m_line.data() == other.m_line.data());
+	}
+	bool operator==(std::default_sentinel_t) const { return m_end; }
+
+private:
+	void advance()
+	{
+		if (m_rest.empty()) {
+			m_end = true;
+			return;
+		}
+		const auto pos = m_rest.find('\n');
+		m_line = m_rest.substr(0, pos);
+		m_rest.remove_prefix(pos == std::string_view::npos ? m_rest.size() : pos + 1);
+		if (!m_line.empty() && m_line.back() == '\r') {
+			m_line.remove_suffix(1);
+		}
+	}
+
+	std::string_view m_rest;
+	std::string_view m_line;
+	bool m_end = false;
+};
+
+class Lines : public std::ranges::view_interface<Lines>
+{
+public:
+	Lines() = default;
+	explicit Lines(std::string_view text)
+	    : m_text(text)
+	{
+	}
+
+	LineIterator begin() const { return LineIterator(m_text); }
+	std::default_sentinel_t end() const { return {}; }
+
+private:
+	std::string_view m_text;
+};
+
+inline Lines lines(std::string_view text)
+{
+	return Lines(text);
+}
+
+// Smallest piece of text worth handing to a thread of its own
+inline constexpr std::size_t parallel_parse_min_bytes = 256 * 1024;
+
+// Piece number chunk of the text split into chunks pieces of about equal size. The pieces start at the beginning of a
+// line and together cover the text, so every line is in exactly one of them. Pieces may be empty.
+inline std::string_view line_chunk(std::string_view text, std::size_t chunk, std::size_t chunks)
+{
+	auto boundary = [&](std::size_t idx) {
+		if (idx == 0 || idx >= chunks) {
+			return idx == 0 ? std::size_t{0} : text.size();
+		}
+		// The line break before the nominal start or the first one after it
+		const auto pos = text.find('\n', text.size() * idx / chunks - 1);
+		return pos == std::string_view::npos ? text.size() : pos + 1;
+	};
+	const auto begin = boundary(chunk);
+	return text.substr(begin, std::max(begin, boundary(chunk + 1)) - begin);
+}
+
+// Text view of raw input bytes
+inline std::string_view as_text(std::span<const std::byte> bytes)
+{
+	return {reinterpret_cast<const char*>(bytes.data()), bytes.size()};
+}
+
+// Read only view of the whole file content. The file is memory mapped where the platform supports it,
+// otherwise (or if mapping fails) it is read into a buffer.
+class MappedFile
+{
+public:
+	explicit MappedFile(const std::filesystem::path& file_path);
+	~MappedFile();
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+	MappedFile(MappedFile&& other) noexcept;
+	MappedFile& operator=(MappedFile&& other) noexcept;
+
+	std::string_view view() const { return m_mapped ? std::string_view(m_data, m_size) : std::string_view(m_buffer); }
+	Lines lines() const { return Lines(view()); }
+
+private:
+	void unmap() noexcept;
+
+	const char* m_data = nullptr;
+	std::size_t m_size = 0;
+	bool m_mapped = false;
+	std::string m_buffer;
+};
+
+// Sequential reader of a file in pieces of whole lines through a caller provided buffer, so the memory used does
+// not depend on the file size. Lines must be shorter than the buffer.
+class ChunkReader
+{
+public:
+	ChunkReader(const std::filesystem::path& file_path, std::span<char> buffer);
+
+	// Next piece of complete lines (the last line of the file may miss its line break), empty at the end of the file
+	std::string_view next();
+
+private:
+	std::ifstream m_file;
+	std::span<char> m_buffer;
+	// Bytes of an incomplete line left over from the previous read
+	std::size_t m_rest_begin = 0;
+	std::size_t m_rest_end = 0;
+};
 
 template <typename T>
-std::vector<std::vector<T>> load_rows(const std::filesystem::path& file_path)
+std::vector<std::vector<T>> load_rows(std::string_view text)
 {
 	std::vector<std::vector<T>> ret;
-	std::ifstream in_file(file_path);
-	for (std::string line; std::getline(in_file, line);) {
+	for (const auto line : utils::lines(text)) {
 		std::vector<T> row;
-		std::istringstream istream(line);
 		T col;
-		while (istream >> col) {
-			row.emplace_back(col);
+		if constexpr (ScannableInt<T>) {
+			IntScanner scanner(line);
+			while (scanner.next(col)) {
+				row.emplace_back(col);
+			}
+		}
+		else {
+			std::ispanstream istream(std::span<const char>(line.data(), line.size()));
+			while (istream >> col) {
+				row.emplace_back(col);
+			}
 		}
-		ret.emplace_back(row);
+		ret.emplace_back(std::move(row));
 	}
 	return ret;
 }
 
+template <typename T>
+std::vector<std::vector<T>> load_rows(const std::filesystem::path& file_path)
+{
+	const MappedFile file(file_path);
+	return load_rows<T>(file.view());
+}
+
 }  // namespace utils
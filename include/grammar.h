@@ -0,0 +1,230 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string_view>
+
+// Token shapes declared at compile time and compiled into table driven DFAs, for example
+//   using Mul = Pattern<Lit<"mul(">, Int<1, 3>, Lit<",">, Int<1, 3>, Lit<")">>;
+// Mul::match("mul(12,345)...") returns the length of the token and the captured numbers {12, 345}.
+namespace utils::grammar
+{
+// String literal usable as a template argument
+template <std::size_t N>
+struct Literal
+{
+	constexpr Literal(const char (&text)[N]) { std::copy_n(text, N, chars); }
+	constexpr std::string_view view() const { return {chars, N - 1}; }
+
+	char chars[N]{};
+};
+
+// Matches the literal text
+template <Literal Text>
+struct Lit
+{
+	static_assert(Text.view().size() > 0, "Empty literal");
+};
+
+// Matches a decimal number of MinDigits to MaxDigits digits and captures its value
+template <int MinDigits, int MaxDigits>
+struct Int
+{
+	static_assert(0 < MinDigits && MinDigits <= MaxDigits && MaxDigits <= 18, "Invalid digit count");
+};
+
+// True if the text starts with the literal. Literals of up to 8 bytes are compared as one 64 bit word when the
+// text is long enough.
+inline bool starts_with_literal(std::string_view text, std::string_view literal)
+{
+	if (text.size() < sizeof(std::uint64_t) || literal.size() > sizeof(std::uint64_t)) {
+		return text.starts_with(literal);
+	}
+	std::uint64_t word;
+	std::uint64_t expected = 0;
+	std::memcpy(&word, text.data(), sizeof(word));
+	std::memcpy(&expected, literal.data(), literal.size());
+	const auto used =
+	    literal.size() == sizeof(word) ? ~std::uint64_t{0} : (std::uint64_t{1} << (8 * literal.size())) - 1;
+	return (word & used) == expected;
+}
+
+namespace detail
+{
+// Uniform description of a part, numbers have no text
+struct PartInfo
+{
+	std::string_view text;
+	int min_digits = 0;
+	int max_digits = 0;
+};
+
+template <typename Part>
+struct PartOf;
+
+template <Literal Text>
+struct PartOf<Lit<Text>>
+{
+	static constexpr PartInfo value{Text.view()};
+};
+
+template <int MinDigits, int MaxDigits>
+struct PartOf<Int<MinDigits, MaxDigits>>
+{
+	static constexpr PartInfo value{{}, MinDigits, MaxDigits};
+};
+
+// State 0 rejects, state 1 is the start state
+inline constexpr std::uint8_t dead_state = 0;
+inline constexpr std::uint8_t start_state = 1;
+
+// One state after every literal character and after every digit of a number
+template <std::size_t Parts>
+constexpr std::size_t state_count(const std::array<PartInfo, Parts>& parts)
+{
+	std::size_t states = 2;
+	for (const auto& part : parts) {
+		states += part.text.empty() ? static_cast<std::size_t>(part.max_digits) : part.text.size();
+	}
+	return states;
+}
+
+// Patterns start and end with a literal, numbers are followed by a literal which does not start with a digit.
+// Then every character has at most one transition, which keeps the automaton deterministic.
+template <std::size_t Parts>
+constexpr bool is_deterministic(const std::array<PartInfo, Parts>& parts)
+{
+	if (parts.front().text.empty() || parts.back().text.empty()) {
+		return false;
+	}
+	for (std::size_t idx = 0; idx + 1 < Parts; ++idx) {
+		const auto& next = parts[idx + 1].text;
+		if (parts[idx].text.empty() && (next.empty() || (next.front() >= '0' && next.front() <= '9'))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// Transitions are indexed by the byte itself, patterns have few states so the table stays small
+template <std::size_t States>
+struct Tables
+{
+	std::array<std::array<std::uint8_t, 256>, States> next{};
+	// Capture a digit moving into the state belongs to, -1 for literal states
+	std::array<std::int8_t, States> capture{};
+	std::uint8_t accept = dead_state;
+};
+
+template <typename... Parts>
+inline constexpr std::array<PartInfo, sizeof...(Parts)> parts_of{PartOf<Parts>::value...};
+
+template <typename... Parts>
+constexpr auto build_tables()
+{
+	constexpr auto& parts = parts_of<Parts...>;
+	constexpr auto states = state_count(parts);
+	static_assert(states <= 256, "Pattern too long");
+	static_assert(is_deterministic(parts), "Ambiguous pattern");
+
+	Tables<states> tables;
+	tables.capture.fill(-1);
+	// The states the next part continues from are [entry_first, entry_last]
+	std::uint8_t entry_first = start_state;
+	std::uint8_t entry_last = start_state;
+	std::uint8_t state = start_state;
+	std::int8_t capture = 0;
+	auto link = [&](char first, char last) {
+		for (auto from = entry_first; from <= entry_last; ++from) {
+			for (auto c = first; c <= last; ++c) {
+				tables.next[from][static_cast<unsigned char>(c)] = static_cast<std::uint8_t>(state + 1);
+			}
+		}
+		++state;
+	};
+	for (const auto& part : parts) {
+		if (!part.text.empty()) {
+			for (const char c : part.text) {
+				link(c, c);
+				entry_first = entry_last = state;
+			}
+			continue;
+		}
+		// The number may end after min_digits to max_digits digits
+		const auto first_digit = static_cast<std::uint8_t>(state + 1);
+		for (int digit = 0; digit < part.max_digits; ++digit) {
+			link('0', '9');
+			tables.capture[state] = capture;
+			entry_first = entry_last = state;
+		}
+		entry_first = static_cast<std::uint8_t>(first_digit + part.min_digits - 1);
+		++capture;
+	}
+	tables.accept = state;
+	return tables;
+}
+}  // namespace detail
+
+template <typename... Parts>
+class Pattern
+{
+	static constexpr auto& parts = detail::parts_of<Parts...>;
+
+public:
+	static constexpr std::size_t captures =
+	    static_cast<std::size_t>(std::ranges::count_if(parts, [](const auto& part) { return part.text.empty(); }));
+	// First character of every match
+	static constexpr char first_char = parts.front().text.front();
+
+	struct Match
+	{
+		std::size_t length = 0;
+		std::array<std::int64_t, captures> values{};
+	};
+
+	// Match at the start of the text, the numbers are accumulated while the DFA walks their digits
+	static constexpr std::optional<Match> match(std::string_view text)
+	{
+		Match match;
+		auto state = detail::start_state;
+		std::size_t pos = 0;
+		if !consteval {
+			// Most candidates fail on the leading literal, which is compared as one word first
+			if (!starts_with_literal(text, prefix)) {
+				return std::nullopt;
+			}
+			pos = prefix.size();
+			state = static_cast<std::uint8_t>(state + pos);
+			if (state == tables.accept) {
+				match.length = pos;
+				return match;
+			}
+		}
+		for (; pos < text.size(); ++pos) {
+			const auto c = static_cast<unsigned char>(text[pos]);
+			state = tables.next[state][c];
+			if (state == detail::dead_state) {
+				return std::nullopt;
+			}
+			if (const auto capture = tables.capture[state]; capture >= 0) {
+				auto& value = match.values[static_cast<std::size_t>(capture)];
+				value = value * 10 + (c - '0');
+			}
+			if (state == tables.accept) {
+				match.length = pos + 1;
+				return match;
+			}
+		}
+		return std::nullopt;
+	}
+
+private:
+	static constexpr auto tables = detail::build_tables<Parts...>();
+	static constexpr auto prefix = parts.front().text;
+};
+
+}  // namespace utils::grammar
@@ -0,0 +1,229 @@
+#pragma once
+
+#include "common.h"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <format>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace utils
+{
+// View of every stride-th element starting at first, used for grid columns and diagonals
+template <typename T>
+class StridedView : public std::ranges::view_interface<StridedView<T>>
+{
+public:
+	class Iterator
+	{
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = std::remove_cv_t<T>;
+		using difference_type = std::ptrdiff_t;
+
+		Iterator() = default;
+		Iterator(T* first, std::ptrdiff_t stride, std::size_t idx)
+		    : m_first(first)
+		    , m_stride(stride)
+		    , m_idx(idx)
+		{
+		}
+
+		T& operator*() const { return m_first[static_cast<std::ptrdiff_t>(m_idx) * m_stride]; }
+		Iterator& operator++()
+		{
+			++m_idx;
+			return *this;
+		}
+		Iterator operator++(int)
+		{
+			auto tmp = *this;
+			++m_idx;
+			return tmp;
+		}
+		bool operator==(const Iterator& other) const { return m_idx == other.m_idx; }
+
+	private:
+		T* m_first = nullptr;
+		std::ptrdiff_t m_stride = 0;
+		std::size_t m_idx = 0;
+	};
+
+	StridedView() = default;
+	StridedView(T* first, std::ptrdiff_t stride, std::size_t count)
+	    : m_first(first)
+	    , m_stride(stride)
+	    , m_count(count)
+	{
+	}
+
+	Iterator begin() const { return Iterator(m_first, m_stride, 0); }
+	Iterator end() const { return Iterator(m_first, m_stride, m_count); }
+	std::size_t size() const { return m_count; }
+	T& operator[](std::size_t idx) const { return m_first[static_cast<std::ptrdiff_t>(idx) * m_stride]; }
+	// The same elements from the last to the first
+	StridedView reversed() const
+	{
+		if (m_count == 0) {
+			return {m_first, -m_stride, 0};
+		}
+		return {&(*this)[m_count - 1], -m_stride, m_count};
+	}
+
+private:
+	T* m_first = nullptr;
+	std::ptrdiff_t m_stride = 0;
+	std::size_t m_count = 0;
+};
+
+// Two dimensional map stored in one row-major buffer. The map can be surrounded by a border of sentinel cells,
+// so neighbours up to border cells away can be accessed without bounds checks. Rows and columns are indexed
+// from 0 for the first cell inside the border, the border cells have negative or out of size indices.
+template <typename T>
+class Grid
+{
+	static_assert(!std::same_as<T, bool>, "Use std::uint8_t instead of bool cells");
+
+public:
+	using value_type = T;
+
+	Grid() = default;
+	Grid(std::size_t rows, std::size_t cols, const T& fill = T{}, std::size_t border = 0, const T& sentinel = T{})
+	    : m_rows(rows)
+	    , m_cols(cols)
+	    , m_border(border)
+	    , m_stride(cols + 2 * border)
+	    , m_cells((rows + 2 * border) * (cols + 2 * border), sentinel)
+	{
+		for (std::size_t row = 0; row < rows; ++row) {
+			std::ranges::fill(this->row(row), fill);
+		}
+	}
+
+	std::size_t rows() const { return m_rows; }
+	std::size_t cols() const { return m_cols; }
+	std::size_t border() const { return m_border; }
+	// Distance of vertically adjacent cells in the buffer
+	std::ptrdiff_t stride() const { return static_cast<std::ptrdiff_t>(m_stride); }
+
+	bool in_bounds(std::ptrdiff_t row, std::ptrdiff_t col) const
+	{
+		return row >= 0 && col >= 0 && row < static_cast<std::ptrdiff_t>(m_rows)
+		       && col < static_cast<std::ptrdiff_t>(m_cols);
+	}
+
+	// Position in the buffer, neighbours are at index + drow * stride() + dcol
+	std::size_t index(std::ptrdiff_t row, std::ptrdiff_t col) const
+	{
+		const auto border = static_cast<std::ptrdiff_t>(m_border);
+		return static_cast<std::size_t>((row + border) * stride() + col + border);
+	}
+	std::pair<std::ptrdiff_t, std::ptrdiff_t> position(std::size_t index) const
+	{
+		const auto border = static_cast<std::ptrdiff_t>(m_border);
+		const auto idx = static_cast<std::ptrdiff_t>(index);
+		return {idx / stride() - border, idx % stride() - border};
+	}
+
+	T& operator()(std::ptrdiff_t row, std::ptrdiff_t col) { return m_cells[index(row, col)]; }
+	const T& operator()(std::ptrdiff_t row, std::ptrdiff_t col) const { return m_cells[index(row, col)]; }
+	T& operator[](std::size_t index) { return m_cells[index]; }
+	const T& operator[](std::size_t index) const { return m_cells[index]; }
+
+	// Whole buffer including the border
+	std::span<T> cells() { return m_cells; }
+	std::span<const T> cells() const { return m_cells; }
+
+	std::span<T> row(std::size_t row) { return {&(*this)(row, 0), m_cols}; }
+	std::span<const T> row(std::size_t row) const { return {&(*this)(row, 0), m_cols}; }
+	StridedView<T> column(std::size_t col) { return {&(*this)(0, col), stride(), m_rows}; }
+	StridedView<const T> column(std::size_t col) const { return {&(*this)(0, col), stride(), m_rows}; }
+	// Cells from (row, col) down and to the right
+	StridedView<T> diagonal(std::size_t row, std::size_t col)
+	{
+		return {&(*this)(row, col), stride() + 1, std::min(m_rows - row, m_cols - col)};
+	}
+	StridedView<const T> diagonal(std::size_t row, std::size_t col) const
+	{
+		return {&(*this)(row, col), stride() + 1, std::min(m_rows - row, m_cols - col)};
+	}
+	// Cells from (row, col) down and to the left
+	StridedView<T> anti_diagonal(std::size_t row, std::size_t col)
+	{
+		return {&(*this)(row, col), stride() - 1, std::min(m_rows - row, col + 1)};
+	}
+	StridedView<const T> anti_diagonal(std::size_t row, std::size_t col) const
+	{
+		return {&(*this)(row, col), stride() - 1, std::min(m_rows - row, col + 1)};
+	}
+
+	// Position of the first cell with the value
+	std::optional<std::pair<std::ptrdiff_t, std::ptrdiff_t>> find(const T& value) const
+	{
+		for (std::size_t row = 0; row < m_rows; ++row) {
+			const auto cells = this->row(row);
+			const auto it = std::ranges::find(cells, value);
+			if (it != cells.end()) {
+				return std::make_pair(static_cast<std::ptrdiff_t>(row), it - cells.begin());
+			}
+		}
+		return std::nullopt;
+	}
+
+	bool operator==(const Grid&) const = default;
+
+private:
+	std::size_t m_rows = 0;
+	std::size_t m_cols = 0;
+	std::size_t m_border = 0;
+	std::size_t m_stride = 0;
+	std::vector<T> m_cells;
+};
+
+// Builds a grid from the lines of the text, every character is converted to one cell. Empty lines are skipped.
+template <typename T = char, typename Convert = std::identity>
+Grid<T> load_grid(std::string_view text, std::size_t border = 0, const T& sentinel = T{}, Convert convert = {})
+{
+	std::size_t rows = 0;
+	std::size_t cols = 0;
+	for (const auto line : utils::lines(text)) {
+		if (line.empty()) {
+			continue;
+		}
+		if (rows != 0 && line.size() != cols) {
+			throw std::invalid_argument(std::format("Line {} has {} columns, expected {}", rows + 1, line.size(), cols));
+		}
+		cols = line.size();
+		++rows;
+	}
+
+	Grid<T> grid(rows, cols, sentinel, border, sentinel);
+	std::size_t row = 0;
+	for (const auto line : utils::lines(text)) {
+		if (!line.empty()) {
+			std::ranges::transform(line, grid.row(row++).begin(), convert);
+		}
+	}
+	return grid;
+}
+
+template <typename T = char, typename Convert = std::identity>
+Grid<T> load_grid(const std::filesystem::path& file_path,
+                  std::size_t border = 0,
+                  const T& sentinel = T{},
+                  Convert convert = {})
+{
+	const MappedFile file(file_path);
+	return load_grid<T>(file.view(), border, sentinel, convert);
+}
+
+}  // namespace utils
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "common.h"
+#include "scanner.h"
+
+#include <cstddef>
+#include <filesystem>
+#include <iterator>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace utils
+{
+// Rows of different lengths stored in compressed sparse row form: the values of all rows back to back in one
+// buffer and the offset of every row start, with the end of the last row as the final offset. Row r is
+// values()[offsets()[r]] to values()[offsets()[r + 1] - 1].
+template <typename T>
+class JaggedArray
+{
+public:
+	class Iterator
+	{
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = std::span<const T>;
+		using difference_type = std::ptrdiff_t;
+
+		Iterator() = default;
+		Iterator(const JaggedArray* array, std::size_t row)
+		    : m_array(array)
+		    , m_row(row)
+		{
+		}
+
+		std::span<const T> operator*() const { return (*m_array)[m_row]; }
+		Iterator& operator++()
+		{
+			++m_row;
+			return *this;
+		}
+		Iterator operator++(int)
+		{
+			auto tmp = *this;
+			++m_row;
+			return tmp;
+		}
+		bool operator==(const Iterator& other) const { return m_row == other.m_row; }
+
+	private:
+		const JaggedArray* m_array = nullptr;
+		std::size_t m_row = 0;
+	};
+
+	JaggedArray() = default;
+
+	std::size_t rows() const { return m_offsets.size() - 1; }
+	bool empty() const { return rows() == 0; }
+
+	std::span<const T> operator[](std::size_t row) const
+	{
+		return std::span<const T>(m_values).subspan(m_offsets[row], m_offsets[row + 1] - m_offsets[row]);
+	}
+	std::span<T> operator[](std::size_t row)
+	{
+		return std::span<T>(m_values).subspan(m_offsets[row], m_offsets[row + 1] - m_offsets[row]);
+	}
+
+	Iterator begin() const { return Iterator(this, 0); }
+	Iterator end() const { return Iterator(this, rows()); }
+
+	std::span<const T> values() const { return m_values; }
+	std::span<const std::size_t> offsets() const { return m_offsets; }
+
+	// Rows are built by appending values to the last row and closing it
+	void push_value(const T& value) { m_values.push_back(value); }
+	void end_row() { m_offsets.push_back(m_values.size()); }
+	void reserve(std::size_t rows, std::size_t values)
+	{
+		m_offsets.reserve(rows + 1);
+		m_values.reserve(values);
+	}
+
+	bool operator==(const JaggedArray&) const = default;
+
+private:
+	std::vector<T> m_values;
+	std::vector<std::size_t> m_offsets{0};
+};
+
+// Reads the numbers of every line as one row, empty lines give empty rows
+template <ScannableInt T>
+JaggedArray<T> load_jagged_rows(std::string_view text)
+{
+	JaggedArray<T> rows;
+	for (const auto line : utils::lines(text)) {
+		IntScanner scanner(line);
+		for (T value; scanner.next(value);) {
+			rows.push_value(value);
+		}
+		rows.end_row();
+	}
+	return rows;
+}
+
+template <ScannableInt T>
+JaggedArray<T> load_jagged_rows(const std::filesystem::path& file_path)
+{
+	const MappedFile file(file_path);
+	return load_jagged_rows<T>(file.view());
+}
+
+}  // namespace utils
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace utils
+{
+// Integer keys sorted by radix_sort
+template <typename T>
+concept RadixKey = std::integral<T> && (sizeof(T) == 4 || sizeof(T) == 8) && !std::same_as<T, bool>;
+
+// Below this many 32 bit keys std::ranges::sort is faster than clearing and filling the digit histograms
+inline constexpr std::size_t radix_sort_min_size = 1024;
+
+namespace detail
+{
+// Unsigned key with the same order as the original key, the sign bit of signed keys is flipped
+template <RadixKey T>
+std::make_unsigned_t<T> radix_bits(T key)
+{
+	using U = std::make_unsigned_t<T>;
+	if constexpr (std::is_signed_v<T>) {
+		return static_cast<U>(key) ^ (U{1} << (8 * sizeof(T) - 1));
+	}
+	else {
+		return key;
+	}
+}
+}  // namespace detail
+
+// Sorts the keys in ascending order with a least significant digit radix sort on 11 bit digits. The scratch
+// buffer is resized to the number of keys and can be reused by the caller between sorts. Digits which are the
+// same in all keys are skipped, so keys from a small range need fewer passes.
+template <RadixKey T>
+void radix_sort(std::span<T> keys, std::vector<T>& scratch)
+{
+	constexpr int digit_bits = 11;
+	constexpr std::size_t buckets = std::size_t{1} << digit_bits;
+	constexpr int passes = (8 * sizeof(T) + digit_bits - 1) / digit_bits;
+	if (keys.size() < 2) {
+		return;
+	}
+
+	// Histograms of all digits in one read of the keys
+	std::vector<std::array<std::size_t, buckets>> counts(passes);
+	for (const auto key : keys) {
+		const auto bits = detail::radix_bits(key);
+		for (int pass = 0; pass < passes; ++pass) {
+			++counts[pass][(bits >> (pass * digit_bits)) & (buckets - 1)];
+		}
+	}
+
+	scratch.resize(keys.size());
+	std::span<T> from = keys;
+	std::span<T> to = scratch;
+	for (int pass = 0; pass < passes; ++pass) {
+		auto& count = counts[pass];
+		const auto first_bits = detail::radix_bits(keys.front());
+		if (count[(first_bits >> (pass * digit_bits)) & (buckets - 1)] == keys.size()) {
+			continue;
+		}
+		// Counts to the start offsets of the buckets
+		std::size_t offset = 0;
+		for (auto& bucket : count) {
+			const auto size = bucket;
+			bucket = offset;
+			offset += size;
+		}
+		for (const auto key : from) {
+			to[count[(detail::radix_bits(key) >> (pass * digit_bits)) & (buckets - 1)]++] = key;
+		}
+		std::swap(from, to);
+	}
+	if (from.data() != keys.data()) {
+		std::ranges::copy(from, keys.begin());
+	}
+}
+
+// Sorts the keys with a temporary scratch buffer
+template <RadixKey T>
+void radix_sort(std::span<T> keys)
+{
+	std::vector<T> scratch;
+	radix_sort(keys, scratch);
+}
+
+}  // namespace utils
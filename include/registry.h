@@ -0,0 +1,127 @@
+#pragma once
+
+#include "solvers.h"
+
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+// Uniform answer type of all solvers
+using Answer = std::int64_t;
+
+// Answers for the bundled input/dayN.small.txt and input/dayN.full.txt files
+struct ExpectedAnswers
+{
+	std::optional<Answer> small;
+	std::optional<Answer> full;
+};
+
+// Compile time description of one part of a day. Parse and Solve are stateless callables, so calls through
+// an entry are resolved statically and can be inlined.
+template <int Day, int Part, typename Parse, typename Solve>
+struct SolverEntry
+{
+	static constexpr int day = Day;
+	static constexpr int part = Part;
+
+	Parse parse;
+	Solve solve;
+	ExpectedAnswers expected;
+	// Too slow on the full input to be run by default
+	bool slow = false;
+
+	Answer run(std::string_view text) const { return solve(parse(text)); }
+};
+
+template <int Day, int Part, typename Parse, typename Solve>
+constexpr SolverEntry<Day, Part, Parse, Solve> make_solver(Parse parse,
+                                                           Solve solve,
+                                                           ExpectedAnswers expected,
+                                                           bool slow = false)
+{
+	return {parse, solve, expected, slow};
+}
+
+// All solvers in the order of days and parts
+inline constexpr auto solvers = std::make_tuple(
+    make_solver<1, 1>(parse_day1, [](Day1Input input) -> Answer { return solve_day1(1, std::move(input)); },
+                      {11, 2'815'556}),
+    make_solver<1, 2>(parse_day1, [](Day1Input input) -> Answer { return solve_day1(2, std::move(input)); },
+                      {31, 23'927'637}),
+    make_solver<2, 1>(parse_day2, [](const Day2Input& input) -> Answer { return solve_day2(1, input); }, {2, 218}),
+    make_solver<2, 2>(parse_day2, [](const Day2Input& input) -> Answer { return solve_day2(2, input); }, {4, 290}),
+    // Day 3 scans the text directly
+    make_solver<3, 1>(std::identity{}, [](std::string_view input) -> Answer { return solve_day3(1, input); },
+                      {161, 170'807'108}),
+    make_solver<3, 2>(std::identity{}, [](std::string_view input) -> Answer { return solve_day3(2, input); },
+                      {48, 74'838'033}),
+    make_solver<4, 1>(parse_day4, [](const Day4Input& input) -> Answer { return solve_day4(1, input); },
+                      {18, 2'593}),
+    make_solver<4, 2>(parse_day4, [](const Day4Input& input) -> Answer { return solve_day4(2, input); },
+                      {9, 1'950}),
+    make_solver<5, 1>(parse_day5, [](const Day5Input& input) -> Answer { return solve_day5(1, input); },
+                      {143, 4'637}),
+    make_solver<5, 2>(parse_day5, [](const Day5Input& input) -> Answer { return solve_day5(2, input); },
+                      {123, 6'370}),
+    make_solver<6, 1>(parse_day6, [](const Day6Input& input) -> Answer { return solve_day6(1, input); },
+                      {41, 4'967}),
+    make_solver<6, 2>(parse_day6, [](const Day6Input& input) -> Answer { return solve_day6(2, input); },
+                      {6, 1'789}),
+    make_solver<7, 1>(parse_day7, [](const Day7Input& input) -> Answer { return solve_day7(1, input); },
+                      {3'749, 14'711'933'466'277}),
+    make_solver<7, 2>(parse_day7, [](const Day7Input& input) -> Answer { return solve_day7(2, input); },
+                      {11'387, 286'580'387'663'654}, true),
+    make_solver<8, 1>(parse_day8, [](const Day8Input& input) -> Answer { return solve_day8(1, input); }, {14, 303}),
+    make_solver<8, 2>(parse_day8, [](const Day8Input& input) -> Answer { return solve_day8(2, input); },
+                      {34, 1'045}),
+    make_solver<9, 1>(parse_day9, [](Day9Input input) -> Answer { return solve_day9(1, std::move(input)); },
+                      {1'928, 6'370'402'949'053}),
+    make_solver<9, 2>(parse_day9, [](Day9Input input) -> Answer { return solve_day9(2, std::move(input)); },
+                      {2'858, 6'398'096'697'992}),
+    make_solver<10, 1>(parse_day10, [](const Day10Input& input) -> Answer { return solve_day10(1, input); },
+                       {36, 646}),
+    make_solver<10, 2>(parse_day10, [](const Day10Input& input) -> Answer { return solve_day10(2, input); },
+                       {81, 1'494}),
+    // Day 11 parts differ by the number of blinks
+    make_solver<11, 1>(parse_day11, [](const Day11Input& input) -> Answer { return solve_day11(25, input); },
+                       {55'312, 197'157}),
+    make_solver<11, 2>(parse_day11, [](const Day11Input& input) -> Answer { return solve_day11(75, input); },
+                       {65'601'038'650'482, 234'430'066'982'597}));
+
+inline constexpr std::size_t solver_count = std::tuple_size_v<std::remove_cvref_t<decltype(solvers)>>;
+
+// Calls the function with every solver entry, the loop is unrolled at compile time
+template <typename Function>
+constexpr void for_each_solver(Function&& function)
+{
+	std::apply([&](const auto&... solver) { (function(solver), ...); }, solvers);
+}
+
+// Calls the function with the entry of the given day and part, returns false if there is no such solver
+template <typename Function>
+constexpr bool visit_solver(int day, int part, Function&& function)
+{
+	bool found = false;
+	for_each_solver([&](const auto& solver) {
+		if (!found && solver.day == day && solver.part == part) {
+			found = true;
+			function(solver);
+		}
+	});
+	return found;
+}
+
+// Parses and solves the text with the solver of the given day and part
+inline Answer run_solver(int day, int part, std::string_view text)
+{
+	Answer answer = 0;
+	if (!visit_solver(day, part, [&](const auto& solver) { answer = solver.run(text); })) {
+		throw std::logic_error(std::format("Unknown day {} part {}", day, part));
+	}
+	return answer;
+}
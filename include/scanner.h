@@ -0,0 +1,127 @@
+#pragma once
+
+#include <bit>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+namespace utils
+{
+// Integer types the scanner parses as numbers (character types are excluded)
+template <typename T>
+concept ScannableInt = std::integral<T> && !std::same_as<T, bool> && !std::same_as<T, char>
+                       && !std::same_as<T, signed char> && !std::same_as<T, unsigned char>;
+
+namespace detail
+{
+// Number of leading decimal digits in the 8 bytes loaded from the buffer (little endian, first char in the lowest byte)
+inline int swar_digit_count(std::uint64_t chunk)
+{
+	constexpr std::uint64_t high_nibbles = 0xF0F0F0F0F0F0F0F0;
+	constexpr std::uint64_t zeros = 0x3030303030303030;
+	// Non zero byte where the high nibble is not 3 or the low nibble is greater than 9
+	const std::uint64_t non_digit = ((chunk & high_nibbles) ^ zeros) | (((chunk + 0x0606060606060606) & high_nibbles) ^ zeros);
+	// Set the top bit of every non zero byte without carries between bytes
+	constexpr std::uint64_t low_bits = 0x7F7F7F7F7F7F7F7F;
+	const std::uint64_t flags = (((non_digit & low_bits) + low_bits) | non_digit) & ~low_bits;
+	return std::countr_zero(flags) / 8;
+}
+
+// Converts 1 to 8 leading digit characters of the chunk to their value
+inline std::uint32_t swar_parse_digits(std::uint64_t chunk, int digits)
+{
+	// Move the digits to the top bytes, the freed low bytes act as leading zeros
+	chunk <<= 8 * (8 - digits);
+	chunk = ((chunk & 0x0F0F0F0F0F0F0F0F) * 2561) >> 8;
+	chunk = ((chunk & 0x00FF00FF00FF00FF) * 6553601) >> 16;
+	return static_cast<std::uint32_t>(((chunk & 0x0000FFFF0000FFFF) * 42949672960001) >> 32);
+}
+}  // namespace detail
+
+// Parses the integer at the beginning of the text without allocating. An optional '-' sign is accepted for signed
+// types. Returns the number of consumed characters, 0 if the text does not start with a number which fits into T.
+template <ScannableInt T>
+std::size_t parse_int(std::string_view text, T& value)
+{
+	const char* first = text.data();
+	const char* last = first + text.size();
+	if constexpr (std::endian::native == std::endian::little) {
+		// Fast path for short unsigned fields with at least 8 readable bytes
+		if (last - first >= 8 && *first != '-') {
+			std::uint64_t chunk;
+			std::memcpy(&chunk, first, sizeof(chunk));
+			const int digits = detail::swar_digit_count(chunk);
+			if (digits > 0 && digits < 8) {
+				const auto parsed = detail::swar_parse_digits(chunk, digits);
+				if (parsed <= static_cast<std::make_unsigned_t<T>>(std::numeric_limits<T>::max())) {
+					value = static_cast<T>(parsed);
+					return static_cast<std::size_t>(digits);
+				}
+			}
+		}
+	}
+	const auto [ptr, ec] = std::from_chars(first, last, value);
+	if (ec != std::errc{}) {
+		return 0;
+	}
+	return static_cast<std::size_t>(ptr - first);
+}
+
+// Parses the whole text as one integer, throws if it is not a number
+template <ScannableInt T>
+T to_int(std::string_view text)
+{
+	T value{};
+	if (text.empty() || parse_int(text, value) != text.size()) {
+		throw std::invalid_argument(std::format("Not a number: '{}'", text));
+	}
+	return value;
+}
+
+// Sequential reader of the integers in a text. Any characters which are not part of a number act as separators.
+class IntScanner
+{
+public:
+	explicit IntScanner(std::string_view text)
+	    : m_text(text)
+	{
+	}
+
+	// Reads the next number, returns false if there is none left
+	template <ScannableInt T>
+	bool next(T& value)
+	{
+		while (m_pos < m_text.size()) {
+			const char c = m_text[m_pos];
+			const bool starts_number =
+			    (c >= '0' && c <= '9')
+			    || (std::is_signed_v<T> && c == '-' && m_pos + 1 < m_text.size() && m_text[m_pos + 1] >= '0'
+			        && m_text[m_pos + 1] <= '9');
+			if (starts_number) {
+				const auto consumed = parse_int(m_text.substr(m_pos), value);
+				if (consumed == 0) {
+					throw std::out_of_range(std::format("Number out of range at offset {}", m_pos));
+				}
+				m_pos += consumed;
+				return true;
+			}
+			++m_pos;
+		}
+		return false;
+	}
+
+	std::string_view rest() const { return m_text.substr(m_pos); }
+
+private:
+	std::string_view m_text;
+	std::size_t m_pos = 0;
+};
+
+}  // namespace utils
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace utils
+{
+// Work-stealing scheduler for data parallel loops. Every worker owns a deque of index ranges: it splits the range
+// it runs in halves down to the grain size, pushes the upper halves to the back of its deque and takes them back
+// from there, while idle workers steal the oldest (largest) ranges from the front of other deques. The calling
+// thread takes part in the loop, so a scheduler of N threads starts N - 1 workers. Loops may be started from any
+// thread, including from inside another loop.
+class Scheduler
+{
+public:
+	// Zero threads selects std::thread::hardware_concurrency()
+	explicit Scheduler(std::size_t threads = 0);
+	~Scheduler();
+
+	Scheduler(const Scheduler&) = delete;
+	Scheduler& operator=(const Scheduler&) = delete;
+
+	// Number of threads taking part in a loop, including the caller
+	std::size_t size() const { return m_workers.size() + 1; }
+
+	// Calls body(idx) for every idx in [begin, end), at most grain indices run as one task. Rethrows the first
+	// exception of the body after the loop finished, the remaining indices may be skipped.
+	template <typename Body>
+	void parallel_for(std::size_t begin, std::size_t end, std::size_t grain, Body&& body)
+	{
+		if (begin >= end) {
+			return;
+		}
+		auto run = [](void* context, std::size_t first, std::size_t last) {
+			auto& fn = *static_cast<std::remove_reference_t<Body>*>(context);
+			for (std::size_t idx = first; idx < last; ++idx) {
+				fn(idx);
+			}
+		};
+		Loop loop(run, const_cast<void*>(static_cast<const void*>(std::addressof(body))), grain, end - begin);
+		execute(loop, begin, end);
+	}
+
+	// Combines map(idx) of every idx in [begin, end) with reduce, starting from init. The indices are split into
+	// chunks of grain indices, every chunk is folded in order and the chunk results are reduced in order, so
+	// reduce has to be associative but not commutative.
+	template <typename T, typename Map, typename Reduce>
+	T parallel_reduce(std::size_t begin, std::size_t end, std::size_t grain, T init, Map map, Reduce reduce)
+	{
+		if (begin >= end) {
+			return init;
+		}
+		grain = std::max<std::size_t>(grain, 1);
+		const auto chunks = (end - begin + grain - 1) / grain;
+		std::vector<T> partial(chunks, init);
+		parallel_for(0, chunks, 1, [&](std::size_t chunk) {
+			const auto first = begin + chunk * grain;
+			const auto last = std::min(first + grain, end);
+			T value = map(first);
+			for (std::size_t idx = first + 1; idx < last; ++idx) {
+				value = reduce(std::move(value), map(idx));
+			}
+			partial[chunk] = std::move(value);
+		});
+		for (auto& value : partial) {
+			init = reduce(std::move(init), std::move(value));
+		}
+		return init;
+	}
+
+private:
+	// State shared by all tasks of one parallel_for call
+	struct Loop
+	{
+		Loop(void (*run_chunk)(void*, std::size_t, std::size_t), void* body, std::size_t min_size, std::size_t count)
+		    : run(run_chunk)
+		    , context(body)
+		    , grain(std::max<std::size_t>(min_size, 1))
+		    , remaining(count)
+		{
+		}
+
+		void (*run)(void* context, std::size_t first, std::size_t last);
+		void* context;
+		std::size_t grain;
+		// Indices not finished yet, the loop is done at zero
+		std::atomic<std::size_t> remaining;
+		std::atomic<bool> failed{false};
+		std::mutex error_mutex;
+		std::exception_ptr error;
+	};
+
+	struct Task
+	{
+		Loop* loop;
+		std::size_t first;
+		std::size_t last;
+	};
+
+	struct alignas(64) Queue
+	{
+		std::mutex mutex;
+		std::deque<Task> tasks;
+	};
+
+	void execute(Loop& loop, std::size_t begin, std::size_t end);
+	void run_task(Task task, std::size_t queue);
+	void push(std::size_t queue, Task task);
+	bool take(std::size_t queue, Task& task);
+	// Queue of the worker running on this thread, one of the external queues for other threads
+	std::size_t own_queue() const;
+	void work(std::size_t index);
+
+	// One queue per worker followed by the external queues, which receive ranges pushed by threads outside the
+	// scheduler so that concurrent outside callers rarely share a queue
+	std::unique_ptr<Queue[]> m_queues;
+	std::size_t m_worker_queues = 0;
+	std::size_t m_queue_count = 0;
+	std::atomic<std::size_t> m_pending{0};
+	// Threads sleeping on m_wake, m_waiting counts those among them which wait for the end of a loop
+	std::atomic<std::size_t> m_sleeping{0};
+	std::atomic<std::size_t> m_waiting{0};
+	std::mutex m_sleep_mutex;
+	std::condition_variable m_wake;
+	std::atomic<bool> m_stop{false};
+	std::vector<std::thread> m_workers;
+};
+
+// Scheduler shared by the solvers, created on first use with std::thread::hardware_concurrency() threads. Only
+// the first call takes a lock.
+Scheduler& default_scheduler();
+
+// Replaces the shared scheduler by one with the given number of threads (0 = all cores). Must not be called while
+// a loop of the shared scheduler is running.
+void set_default_threads(std::size_t threads);
+
+template <typename Body>
+void parallel_for(std::size_t begin, std::size_t end, std::size_t grain, Body&& body)
+{
+	default_scheduler().parallel_for(begin, end, grain, std::forward<Body>(body));
+}
+
+template <typename T, typename Map, typename Reduce>
+T parallel_reduce(std::size_t begin, std::size_t end, std::size_t grain, T init, Map map, Reduce reduce)
+{
+	return default_scheduler().parallel_reduce(begin, end, grain, std::move(init), std::move(map), std::move(reduce));
+}
+
+}  // namespace utils
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace utils
+{
+// Kernels over columns of 32 bit integers and over bytes of text. An AVX2 version is picked at runtime when the CPU supports it,
+// otherwise a portable loop is used. None of them allocates.
+
+// Sum of |a[i] - b[i]| of two equally long columns, accumulated in 64 bit lanes so it cannot overflow
+std::int64_t sum_abs_diff(std::span<const int> a, std::span<const int> b);
+
+// Sum of a[i] * b[i] of two equally long columns, accumulated in 64 bit lanes
+std::int64_t dot_product(std::span<const int> a, std::span<const int> b);
+
+// True if every step values[i + 1] - values[i] is in [min_step, max_step], or every step is in
+// [-max_step, -min_step]. The steps are checked against both bands in one pass. min_step has to be positive.
+bool steps_in_band(std::span<const int> values, int min_step, int max_step);
+
+// Number of rows for which steps_in_band is true. Row r is values[offsets[r]] to values[offsets[r + 1] - 1], so
+// many short rows stored back to back are checked with full vectors. Rows of fewer than two values have no steps
+// and are counted, callers leave out rows which must not count.
+std::size_t count_steps_in_band(std::span<const int> values,
+                                std::span<const std::size_t> offsets,
+                                int min_step,
+                                int max_step);
+
+// Bit i is set if block[i] is a or b, for the first 64 bytes of the block
+std::uint64_t byte_mask(std::string_view block, char a, char b);
+
+// True if the kernels above run the AVX2 version
+bool has_avx2();
+
+}  // namespace utils
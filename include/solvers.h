@@ -0,0 +1,106 @@
+#pragma once
+
+#include "common.h"
+#include "grid.h"
+#include "jagged_array.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Every day is split into a parse step (converts the puzzle text into a day specific structure)
+// and a solve step (computes the answer from the parsed structure), so both can be measured separately.
+// The puzzle can be solved from text in memory or from a file, the file variants only map the file
+// and forward to the text variants. Use utils::as_text for inputs held as bytes.
+
+struct Day1Input
+{
+	std::vector<int> col1;
+	std::vector<int> col2;
+};
+Day1Input parse_day1(std::string_view text);
+std::int64_t solve_day1(int part, Day1Input input);
+std::int64_t solve_day1(int part, std::string_view text);
+std::int64_t solve_day1(int part, const std::filesystem::path& input_file);
+// Solves day 1 from a file of any size while keeping about memory_budget bytes of data. The file is read in chunks,
+// repeatedly if the sorted column values do not fit into the budget at once.
+std::int64_t solve_day1_streaming(int part, const std::filesystem::path& input_file, std::size_t memory_budget);
+
+using Day2Input = utils::JaggedArray<int>;
+Day2Input parse_day2(std::string_view text);
+int solve_day2(int part, const Day2Input& rows);
+// Parses and checks newline aligned pieces of the text in parallel without storing the reports
+int solve_day2(int part, std::string_view text);
+int solve_day2(int part, const std::filesystem::path& input_file);
+
+// The corrupted memory is scanned directly, there is nothing to parse
+std::int64_t solve_day3(int part, std::string_view memory);
+std::int64_t solve_day3(int part, const std::filesystem::path& input_file);
+// Day 3 with the instructions matched by the grammar engine instead of the hand written matchers. It is slower, the
+// grammar bench suite compares the two.
+std::int64_t solve_day3_grammar(int part, std::string_view memory);
+
+using Day4Input = utils::Grid<char>;
+Day4Input parse_day4(std::string_view text);
+int solve_day4(int part, const Day4Input& grid);
+int solve_day4(int part, std::string_view text);
+int solve_day4(int part, const std::filesystem::path& input_file);
+
+struct Day5Input
+{
+	std::vector<std::pair<int, int>> order_rules;
+	utils::JaggedArray<int> updates;
+};
+Day5Input parse_day5(std::string_view text);
+int solve_day5(int part, const Day5Input& input);
+int solve_day5(int part, std::string_view text);
+int solve_day5(int part, const std::filesystem::path& input_file);
+
+using Day6Input = utils::Grid<char>;
+Day6Input parse_day6(std::string_view text);
+int solve_day6(int part, const Day6Input& field);
+int solve_day6(int part, std::string_view text);
+int solve_day6(int part, const std::filesystem::path& input_file);
+
+struct Day7Input
+{
+	// Test value and the numbers of every equation
+	std::vector<std::int64_t> results;
+	utils::JaggedArray<int> nums;
+};
+Day7Input parse_day7(std::string_view text);
+std::int64_t solve_day7(int part, const Day7Input& input);
+std::int64_t solve_day7(int part, std::string_view text);
+std::int64_t solve_day7(int part, const std::filesystem::path& input_file);
+
+using Day8Input = utils::Grid<char>;
+Day8Input parse_day8(std::string_view text);
+std::int64_t solve_day8(int part, const Day8Input& grid);
+std::int64_t solve_day8(int part, std::string_view text);
+std::int64_t solve_day8(int part, const std::filesystem::path& input_file);
+
+struct Day9Input
+{
+	std::vector<std::optional<std::int64_t>> disk;
+	std::int64_t file_count;
+};
+Day9Input parse_day9(std::string_view text);
+std::int64_t solve_day9(int part, Day9Input input);
+std::int64_t solve_day9(int part, std::string_view text);
+std::int64_t solve_day9(int part, const std::filesystem::path& input_file);
+
+using Day10Input = utils::Grid<int>;
+Day10Input parse_day10(std::string_view text);
+std::int64_t solve_day10(int part, const Day10Input& trailmap);
+std::int64_t solve_day10(int part, std::string_view text);
+std::int64_t solve_day10(int part, const std::filesystem::path& input_file);
+
+using Day11Input = std::unordered_map<std::int64_t, std::int64_t>;
+Day11Input parse_day11(std::string_view text);
+std::int64_t solve_day11(int steps, const Day11Input& stones);
+std::int64_t solve_day11(int steps, std::string_view text);
+std::int64_t solve_day11(int steps, const std::filesystem::path& input_file);
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace utils
+{
+// Fixed number of worker threads executing submitted tasks in FIFO order. The destructor finishes all queued
+// tasks before joining the workers.
+class ThreadPool
+{
+public:
+	// Zero threads selects std::thread::hardware_concurrency()
+	explicit ThreadPool(std::size_t threads = 0);
+	~ThreadPool();
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	std::size_t size() const { return m_workers.size(); }
+
+	// Queues the task, the future provides its result or rethrows its exception
+	template <typename Task>
+	std::future<std::invoke_result_t<Task>> submit(Task task)
+	{
+		std::packaged_task<std::invoke_result_t<Task>()> packaged(std::move(task));
+		auto future = packaged.get_future();
+		{
+			std::lock_guard lock(m_mutex);
+			m_tasks.emplace_back(std::move(packaged));
+		}
+		m_wake.notify_one();
+		return future;
+	}
+
+	// Index of the pool worker running the caller, size() when called from another thread
+	std::size_t worker_index() const;
+
+private:
+	void work(std::size_t index);
+
+	std::mutex m_mutex;
+	std::condition_variable m_wake;
+	std::deque<std::move_only_function<void()>> m_tasks;
+	bool m_stop = false;
+	std::vector<std::thread> m_workers;
+};
+
+}  // namespace utils
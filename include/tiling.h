@@ -0,0 +1,48 @@
+#pragma once
+
+#include "grid.h"
+#include "scheduler.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+namespace utils
+{
+// Horizontal band of a grid handed to one task. The task owns the rows [first, last) and may read the rows
+// [halo_first, halo_last), which extend the band by the halo on both sides as far as the grid reaches. Results
+// anchored at an owned row are counted by exactly one band.
+struct RowBand
+{
+	std::size_t first = 0;
+	std::size_t last = 0;
+	std::size_t halo_first = 0;
+	std::size_t halo_last = 0;
+};
+
+// Smallest number of cells in a band worth a task of its own
+inline constexpr std::size_t band_min_cells = 256 * 1024;
+
+// Splits rows of cols cells into bands of at least band_min_cells cells and combines map(band) of all bands with
+// reduce in row order, starting from init. The bands run in parallel on the default scheduler.
+template <typename T, typename Map, typename Reduce>
+T parallel_bands(std::size_t rows, std::size_t cols, std::size_t halo, T init, Map map, Reduce reduce)
+{
+	const auto band_rows = std::max<std::size_t>(band_min_cells / std::max<std::size_t>(cols, 1), 1);
+	const auto bands = (rows + band_rows - 1) / band_rows;
+	auto map_band = [&](std::size_t band) {
+		const auto first = band * band_rows;
+		const auto last = std::min(first + band_rows, rows);
+		return map(RowBand{first, last, first - std::min(first, halo), std::min(last + halo, rows)});
+	};
+	return parallel_reduce(0, bands, 1, std::move(init), map_band, std::move(reduce));
+}
+
+// Bands over the rows of the grid
+template <typename Cell, typename T, typename Map, typename Reduce>
+T parallel_bands(const Grid<Cell>& grid, std::size_t halo, T init, Map map, Reduce reduce)
+{
+	return parallel_bands(grid.rows(), grid.cols(), halo, std::move(init), std::move(map), std::move(reduce));
+}
+
+}  // namespace utils
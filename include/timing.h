@@ -0,0 +1,30 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace utils
+{
+struct Stats
+{
+	double min;
+	double median;
+	double p99;
+};
+
+// Nearest-rank percentile of sorted samples
+inline double percentile(const std::vector<double>& sorted, std::size_t p)
+{
+	const auto rank = (p * sorted.size() + 99) / 100;
+	return sorted[std::clamp<std::size_t>(rank, 1, sorted.size()) - 1];
+}
+
+// Summary of non-empty samples
+inline Stats compute_stats(std::vector<double> values)
+{
+	std::ranges::sort(values);
+	return {values.front(), percentile(values, 50), percentile(values, 99)};
+}
+
+}  // namespace utils
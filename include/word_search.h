@@ -0,0 +1,44 @@
+#pragma once
+
+#include "grid.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace utils
+{
+// Counts words in a character grid along rows, columns, diagonals and anti-diagonals in both directions, like a
+// word search puzzle. The words are compiled into one Aho-Corasick automaton, so every line is read once per
+// direction whatever the number of words.
+class WordSearch
+{
+public:
+	// Throws std::invalid_argument for an empty word
+	explicit WordSearch(std::span<const std::string_view> words);
+
+	// Number of occurrences of every word, in the order of the constructor words. An occurrence is a start cell
+	// and one of the 8 directions.
+	std::vector<std::int64_t> count(const Grid<char>& grid) const;
+
+private:
+	// Runs the automaton along the line and counts the visits of every state
+	void scan(StridedView<const char> line, std::vector<std::int64_t>& visits) const;
+
+	// Bytes which occur in a word get their own class, all other bytes share class 0
+	std::array<std::uint16_t, 256> m_class{};
+	std::size_t m_classes = 1;
+	// Complete transition table, state * m_classes + class, state 0 is the root
+	std::vector<std::uint32_t> m_next;
+	// Longest proper suffix of every state which is a state too
+	std::vector<std::uint32_t> m_fail;
+	// States in breadth first order, suffixes come before the states they belong to
+	std::vector<std::uint32_t> m_order;
+	// State reached at the end of every word
+	std::vector<std::uint32_t> m_word_end;
+};
+
+}  // namespace utils
@@ -1,11 +1,19 @@
 #include "common.h"
 
-#include <sstream>
+#include <algorithm>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
 #include <string>
+#include <utility>
 
 #if defined(_MSC_VER)
 #include <windows.h>
 #else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 #endif
 
@@ -22,15 +30,104 @@ std::filesystem::path utils::abs_exe_directory()
     #endif
 }
 
-void utils::load_columns(std::vector<int>& col1, std::vector<int>& col2, const std::filesystem::path& file_path)
+utils::MappedFile::MappedFile(const std::filesystem::path& file_path)
 {
-	std::ifstream in_file(file_path);
-	for (std::string line; std::getline(in_file, line);) {
-		std::istringstream istream(line);
-		int first_col;
-		int second_col;
-		istream >> first_col >> second_col;
-		col1.emplace_back(first_col);
-		col2.emplace_back(second_col);
+#if !defined(_MSC_VER)
+	const int fd = ::open(file_path.c_str(), O_RDONLY);
+	if (fd != -1) {
+		struct stat st{};
+		if (::fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+			void* addr = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+			if (addr != MAP_FAILED) {
+				::madvise(addr, static_cast<std::size_t>(st.st_size), MADV_SEQUENTIAL);
+				m_data = static_cast<const char*>(addr);
+				m_size = static_cast<std::size_t>(st.st_size);
+				m_mapped = true;
+			}
+		}
+		::close(fd);
+		if (m_mapped) {
+			return;
+		}
 	}
+#endif
+	// Fallback - read the whole file into the buffer
+	std::ifstream in_file(file_path, std::ios::in | std::ios::binary);
+	if (!in_file) {
+		throw std::runtime_error(std::format("Cannot open file {}", file_path.string()));
+	}
+	m_buffer.assign(std::istreambuf_iterator<char>(in_file), std::istreambuf_iterator<char>());
+}
+
+utils::MappedFile::~MappedFile()
+{
+	unmap();
+}
+
+utils::MappedFile::MappedFile(MappedFile&& other) noexcept
+    : m_data(std::exchange(other.m_data, nullptr))
+    , m_size(std::exchange(other.m_size, 0))
+    , m_mapped(std::exchange(other.m_mapped, false))
+    , m_buffer(std::move(other.m_buffer))
+{
+}
+
+utils::MappedFile& utils::MappedFile::operator=(MappedFile&& other) noexcept
+{
+	if (this != &other) {
+		unmap();
+		m_data = std::exchange(other.m_data, nullptr);
+		m_size = std::exchange(other.m_size, 0);
+		m_mapped = std::exchange(other.m_mapped, false);
+		m_buffer = std::move(other.m_buffer);
+	}
+	return *this;
+}
+
+void utils::MappedFile::unmap() noexcept
+{
+#if !defined(_MSC_VER)
+	if (m_mapped) {
+		::munmap(const_cast<char*>(m_data), m_size);
+	}
+#endif
+	m_data = nullptr;
+	m_size = 0;
+	m_mapped = false;
+}
+
+utils::ChunkReader::ChunkReader(const std::filesystem::path& file_path, std::span<char> buffer)
+    : m_file(file_path, std::ios::in | std::ios::binary)
+    , m_buffer(buffer)
+{
+	if (!m_file) {
+		throw std::runtime_error(std::format("Cannot open file {}", file_path.string()));
+	}
+	if (buffer.empty()) {
+		throw std::invalid_argument("Empty read buffer");
+	}
+}
+
+std::string_view utils::ChunkReader::next()
+{
+	// Move the incomplete line to the front and fill the rest of the buffer
+	std::copy(m_buffer.begin() + m_rest_begin, m_buffer.begin() + m_rest_end, m_buffer.begin());
+	std::size_t filled = m_rest_end - m_rest_begin;
+	if (m_file) {
+		m_file.read(m_buffer.data() + filled, static_cast<std::streamsize>(m_buffer.size() - filled));
+		filled += static_cast<std::size_t>(m_file.gcount());
+	}
+	const std::string_view text(m_buffer.data(), filled);
+	if (!m_file) {
+		// End of the file, everything left is complete
+		m_rest_begin = m_rest_end = 0;
+		return text;
+	}
+	const auto last_break = text.rfind('\n');
+	if (last_break == std::string_view::npos) {
+		throw std::runtime_error(std::format("Line longer than the read buffer of {} bytes", m_buffer.size()));
+	}
+	m_rest_begin = last_break + 1;
+	m_rest_end = filled;
+	return text.substr(0, m_rest_begin);
 }
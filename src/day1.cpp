@@ -0,0 +1,289 @@
+#include "columns.h"
+#include "common.h"
+#include "radix_sort.h"
+#include "simd.h"
+#include "solvers.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <format>
+#include <map>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+// Widest value range of column 2 counted in a dense array, relative to the column length
+constexpr std::size_t dense_range_factor = 4;
+constexpr std::size_t dense_range_min = 1 << 16;
+
+// Number of occurrences of every value of a column in an open addressing hash table with linear probing
+class ValueCounts
+{
+public:
+	explicit ValueCounts(const std::vector<int>& values)
+	    : m_mask(std::bit_ceil(2 * values.size() + 1) - 1)
+	    , m_keys(m_mask + 1)
+	    , m_counts(m_mask + 1, 0)
+	{
+		for (const auto val : values) {
+			auto slot = find_slot(val);
+			m_keys[slot] = val;
+			++m_counts[slot];
+		}
+	}
+
+	int count(int val) const { return static_cast<int>(m_counts[find_slot(val)]); }
+
+private:
+	// Slot of the value or the empty slot where it would be inserted
+	std::size_t find_slot(int val) const
+	{
+		// Fibonacci hashing spreads consecutive values over the whole table
+		auto slot = static_cast<std::size_t>((static_cast<std::uint32_t>(val) * 0x9E3779B97F4A7C15ull) >> 32) & m_mask;
+		while (m_counts[slot] != 0 && m_keys[slot] != val) {
+			slot = (slot + 1) & m_mask;
+		}
+		return slot;
+	}
+
+	std::size_t m_mask;
+	std::vector<int> m_keys;
+	// Zero marks an empty slot
+	std::vector<std::uint32_t> m_counts;
+};
+
+// Approximate memory of one value kept by SortedColumnStream (map node with the value, its count and links)
+constexpr std::size_t stream_entry_bytes = sizeof(std::pair<const int, std::int64_t>) + 4 * sizeof(void*);
+
+// Calls the function with every value of the column (0 or 1) of the file, read in chunks through the buffer
+template <typename Function>
+void for_each_column_value(const std::filesystem::path& input_file, int column, std::span<char> buffer, Function&& fn)
+{
+	utils::ChunkReader reader(input_file, buffer);
+	for (auto chunk = reader.next(); !chunk.empty(); chunk = reader.next()) {
+		// Chunks end at line breaks, so the numbers of a chunk always start in the first column
+		utils::IntScanner scanner(chunk);
+		int values[2];
+		while (scanner.next(values[0]) && scanner.next(values[1])) {
+			fn(values[column]);
+		}
+	}
+}
+
+// Distinct values of one column in ascending order with their number of occurrences. At most max_entries values
+// are held at a time, when they are used up the file is read again for the next smallest values.
+class SortedColumnStream
+{
+public:
+	SortedColumnStream(const std::filesystem::path& input_file,
+	                   int column,
+	                   std::size_t max_entries,
+	                   std::span<char> buffer)
+	    : m_input_file(input_file)
+	    , m_column(column)
+	    , m_max_entries(max_entries)
+	    , m_buffer(buffer)
+	{
+	}
+
+	bool next(int& value, std::int64_t& count)
+	{
+		if (m_pos == m_batch.end()) {
+			if (m_last_batch) {
+				return false;
+			}
+			refill();
+			if (m_batch.empty()) {
+				return false;
+			}
+		}
+		value = m_pos->first;
+		count = m_pos->second;
+		m_last = value;
+		++m_pos;
+		return true;
+	}
+
+private:
+	// Collects the smallest values greater than the last returned one
+	void refill()
+	{
+		m_batch.clear();
+		bool dropped = false;
+		for_each_column_value(m_input_file, m_column, m_buffer, [&](int val) {
+			if (m_last && val <= *m_last) {
+				return;
+			}
+			if (m_batch.size() == m_max_entries && val > m_batch.rbegin()->first) {
+				dropped = true;
+				return;
+			}
+			++m_batch[val];
+			if (m_batch.size() > m_max_entries) {
+				m_batch.erase(std::prev(m_batch.end()));
+				dropped = true;
+			}
+		});
+		m_last_batch = !dropped;
+		m_pos = m_batch.begin();
+	}
+
+	std::filesystem::path m_input_file;
+	int m_column;
+	std::size_t m_max_entries;
+	std::span<char> m_buffer;
+	std::map<int, std::int64_t> m_batch;
+	std::map<int, std::int64_t>::iterator m_pos = m_batch.end();
+	std::optional<int> m_last;
+	// No values left in the file after the current batch
+	bool m_last_batch = false;
+};
+}  // namespace
+
+void sort_column(std::vector<int>& col, std::vector<int>& scratch)
+{
+	if (col.size() >= utils::radix_sort_min_size) {
+		utils::radix_sort(std::span(col), scratch);
+	}
+	else {
+		std::ranges::sort(col);
+	}
+}
+
+std::int64_t solve_day1_part1(std::vector<int>& col1, std::vector<int>& col2)
+{
+	std::vector<int> scratch;
+	sort_column(col1, scratch);
+	sort_column(col2, scratch);
+	return utils::sum_abs_diff(col1, col2);
+}
+
+// Both columns sorted - walk them together, every run of equal values is visited once
+std::int64_t similarity_sorted(const std::vector<int>& col1, const std::vector<int>& col2)
+{
+	std::int64_t result = 0;
+	auto it2 = col2.begin();
+	for (auto it1 = col1.begin(); it1 != col1.end();) {
+		const auto val = *it1;
+		const auto run1 = std::find_if(it1, col1.end(), [val](int v) { return v != val; });
+		it2 = std::lower_bound(it2, col2.end(), val);
+		const auto run2 = std::find_if(it2, col2.end(), [val](int v) { return v != val; });
+		result += static_cast<std::int64_t>(val) * (run1 - it1) * (run2 - it2);
+		it1 = run1;
+		it2 = run2;
+	}
+	return result;
+}
+
+std::int64_t solve_day1_part2(const std::vector<int>& col1, const std::vector<int>& col2)
+{
+	if (col2.empty()) {
+		return 0;
+	}
+	if (std::ranges::is_sorted(col1) && std::ranges::is_sorted(col2)) {
+		return similarity_sorted(col1, col2);
+	}
+
+	// Number of occurrences in column 2 of every value of column 1, summed as val * count by the SIMD kernel
+	std::vector<int> col1_counts(col1.size());
+	const auto [min, max] = std::ranges::minmax(col2);
+	const auto range = static_cast<std::size_t>(static_cast<std::int64_t>(max) - min) + 1;
+	if (range <= std::max(dense_range_min, dense_range_factor * col2.size())) {
+		// Values close together - count them in an array indexed by value
+		std::vector<int> counts(range, 0);
+		for (const auto val : col2) {
+			++counts[static_cast<std::size_t>(val - min)];
+		}
+		std::ranges::transform(col1, col1_counts.begin(), [&](int val) {
+			return val >= min && val <= max ? counts[static_cast<std::size_t>(val - min)] : 0;
+		});
+	}
+	else {
+		const ValueCounts counts(col2);
+		std::ranges::transform(col1, col1_counts.begin(), [&](int val) { return counts.count(val); });
+	}
+	return utils::dot_product(col1, col1_counts);
+}
+
+Day1Input parse_day1(std::string_view text)
+{
+	auto columns = utils::load_columns<int, 2>(text, utils::default_scheduler());
+	return {std::move(columns[0]), std::move(columns[1])};
+}
+
+std::int64_t solve_day1(int part, Day1Input input)
+{
+	if (part == 1) {
+		return solve_day1_part1(input.col1, input.col2);
+	}
+
+	if (part == 2) {
+		return solve_day1_part2(input.col1, input.col2);
+	}
+	throw std::logic_error(std::format("Unknown part {}", part));
+}
+
+std::int64_t solve_day1(int part, std::string_view text)
+{
+	return solve_day1(part, parse_day1(text));
+}
+
+std::int64_t solve_day1(int part, const std::filesystem::path& input_file)
+{
+	const utils::MappedFile file(input_file);
+	return solve_day1(part, file.view());
+}
+
+std::int64_t solve_day1_streaming(int part, const std::filesystem::path& input_file, std::size_t memory_budget)
+{
+	if (part != 1 && part != 2) {
+		throw std::logic_error(std::format("Unknown part {}", part));
+	}
+	// A quarter of the budget for the read buffer, the rest for the sorted values of both columns
+	std::vector<char> buffer(std::clamp<std::size_t>(memory_budget / 4, 256, 1 << 20));
+	const auto entries = (memory_budget - std::min(memory_budget, buffer.size())) / (2 * stream_entry_bytes);
+	if (entries == 0) {
+		throw std::invalid_argument(std::format("Memory budget of {} bytes is too small", memory_budget));
+	}
+	SortedColumnStream col1(input_file, 0, entries, buffer);
+	SortedColumnStream col2(input_file, 1, entries, buffer);
+
+	std::int64_t result = 0;
+	int val1 = 0;
+	int val2 = 0;
+	std::int64_t count1 = 0;
+	std::int64_t count2 = 0;
+	if (part == 1) {
+		// The sorted columns are paired by rank, count1 and count2 are the unpaired copies of the current values
+		while ((count1 != 0 || col1.next(val1, count1)) && (count2 != 0 || col2.next(val2, count2))) {
+			const auto pairs = std::min(count1, count2);
+			result += pairs * (std::max(val1, val2) - static_cast<std::int64_t>(std::min(val1, val2)));
+			count1 -= pairs;
+			count2 -= pairs;
+		}
+		return result;
+	}
+
+	// Values present in both columns contribute val * count in column 1 * count in column 2
+	bool has1 = col1.next(val1, count1);
+	bool has2 = col2.next(val2, count2);
+	while (has1 && has2) {
+		if (val1 < val2) {
+			has1 = col1.next(val1, count1);
+		}
+		else if (val2 < val1) {
+			has2 = col2.next(val2, count2);
+		}
+		else {
+			result += static_cast<std::int64_t>(val1) * count1 * count2;
+			has1 = col1.next(val1, count1);
+			has2 = col2.next(val2, count2);
+		}
+	}
+	return result;
+}
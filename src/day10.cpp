@@ -0,0 +1,78 @@
+#include "common.h"
+#include "grid.h"
+#include "scheduler.h"
+#include "solvers.h"
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+// Height of the border cells, never reachable from any height
+constexpr int outside = -1;
+
+std::vector<std::size_t> find_next_steps(int height, std::size_t coord, const utils::Grid<int>& trailmap)
+{
+	++height;
+	const auto stride = static_cast<std::size_t>(trailmap.stride());
+	std::vector<std::size_t> ret;
+	for (const auto next : {coord - stride, coord + stride, coord - 1, coord + 1}) {
+		if (trailmap[next] == height) {
+			ret.push_back(next);
+		}
+	}
+	return ret;
+}
+
+Day10Input parse_day10(std::string_view text)
+{
+	return utils::load_grid<int>(text, 1, outside, [](char c) { return c - '0'; });
+}
+
+std::int64_t solve_day10(int part, const Day10Input& trailmap)
+{
+	// Find trailheads
+	std::vector<std::size_t> trailheads;
+	for (std::size_t row_idx = 0; row_idx < trailmap.rows(); ++row_idx) {
+		for (std::size_t col_idx = 0; col_idx < trailmap.cols(); ++col_idx) {
+			if (trailmap(row_idx, col_idx) == 0) {
+				trailheads.push_back(trailmap.index(row_idx, col_idx));
+			}
+		}
+	}
+
+	// Find all reachable peaks from each trailhead, trailheads are searched in parallel
+	auto score = [&](std::size_t idx) -> std::int64_t {
+		int height = 0;
+		const auto trailhead = trailheads[idx];
+		auto reachable_points = find_next_steps(height++, trailhead, trailmap);
+		while (height < 9) {
+			std::vector<std::size_t> found;
+			for (const auto& point : reachable_points) {
+				auto f = find_next_steps(height, point, trailmap);
+				for (const auto& v : f) {
+					if (part == 1 && std::ranges::find(found, v) == found.end()) {
+						found.push_back(v);
+					}
+					else if (part == 2){
+						found.push_back(v);
+					}
+				}
+			}
+			++height;
+			reachable_points = found;
+		}
+		return static_cast<std::int64_t>(reachable_points.size());
+	};
+	return utils::parallel_reduce(0, trailheads.size(), 16, std::int64_t{0}, score, std::plus<>{});
+}
+
+std::int64_t solve_day10(int part, std::string_view text)
+{
+	return solve_day10(part, parse_day10(text));
+}
+
+std::int64_t solve_day10(int part, const std::filesystem::path& input_file)
+{
+	const utils::MappedFile file(input_file);
+	return solve_day10(part, file.view());
+}
@@ -0,0 +1,76 @@
+#include "common.h"
+#include "solvers.h"
+
+#include <cmath>
+#include <cstdint>
+#include <ranges>
+#include <unordered_map>
+
+std::unordered_map<std::int64_t, std::int64_t> apply_rules(std::unordered_map<std::int64_t, std::int64_t> stones)
+{
+	std::unordered_map<std::int64_t, std::int64_t> ret;
+	for (const auto& [stone, cnt] : stones) {
+		if (stone == 0) {
+			auto [it, inserted] = ret.emplace(1, cnt);
+			if (!inserted) {
+				it->second += cnt;
+			}
+		}
+		else if ((static_cast<int>(std::log10(stone)) +1) % 2 == 0) {
+			auto d = static_cast<int>(std::pow(10.0, (static_cast<int>(std::log10(stone) + 1) / 2)));
+			auto [it, inserted] = ret.emplace(stone / d, cnt);
+			if (!inserted) {
+				it->second += cnt;
+			}
+			auto [it2, inserted2] = ret.emplace(stone % d, cnt);
+			if (!inserted2) {
+				it2->second += cnt;
+			}
+		}
+		else {
+			auto [it, inserted] = ret.emplace(stone * 2024, cnt);
+			if (!inserted) {
+				it->second += cnt;
+			}
+		}
+
+	}
+	return ret;
+}
+
+Day11Input parse_day11(std::string_view text)
+{
+	Day11Input stones;
+	utils::IntScanner scanner(text);
+	for (std::int64_t num; scanner.next(num);) {
+		auto [it, inserted] = stones.emplace(num, 1);
+		if (!inserted) {
+			it->second += 1;
+		}
+	}
+	return stones;
+}
+
+std::int64_t solve_day11(int steps, const Day11Input& input)
+{
+	auto stones = input;
+	for (int i = 0; i < steps; ++i) {
+		stones = apply_rules(stones);
+	}
+	std::int64_t sum = 0;
+	for (const auto& cnt : std::views::values(stones)) {
+		sum += cnt;
+	}
+	return sum;
+}
+
+std::int64_t solve_day11(int steps, std::string_view text)
+{
+	return solve_day11(steps, parse_day11(text));
+}
+
+std::int64_t solve_day11(int steps, const std::filesystem::path& input_file)
+{
+	const utils::MappedFile file(input_file);
+	return solve_day11(steps, file.view());
+}
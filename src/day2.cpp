@@ -0,0 +1,131 @@
+#include "common.h"
+#include "jagged_array.h"
+#include "scanner.h"
+#include "scheduler.h"
+#include "simd.h"
+#include "solvers.h"
+
+#include <algorithm>
+#include <format>
+#include <functional>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+// Levels change by 1 to 3 and all in the same direction
+bool row_is_stable(std::span<const int> row)
+{
+	return utils::steps_in_band(row, 1, 3);
+}
+
+// Position of the first level which does not differ from the previous kept level by 1 to 3 in the direction
+// (1 increasing, -1 decreasing). The level at skip is left out. Returns the row size if all levels follow.
+std::size_t first_unstable(std::span<const int> row, int direction, std::size_t skip)
+{
+	std::size_t prev = skip == 0 ? 1 : 0;
+	for (std::size_t idx = prev + 1; idx < row.size(); ++idx) {
+		if (idx == skip) {
+			continue;
+		}
+		const auto step = (row[idx] - row[prev]) * direction;
+		if (step < 1 || step > 3) {
+			return idx;
+		}
+		prev = idx;
+	}
+	return row.size();
+}
+
+// True if the row is stable after removing at most one level. The first unstable pair of levels has to lose one
+// of its levels, so only these two removals are tried for each direction.
+bool row_is_stable_dampened(std::span<const int> row)
+{
+	constexpr auto no_skip = static_cast<std::size_t>(-1);
+	for (const int direction : {1, -1}) {
+		const auto idx = first_unstable(row, direction, no_skip);
+		if (idx == row.size() || first_unstable(row, direction, idx - 1) == row.size()
+		    || first_unstable(row, direction, idx) == row.size()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+Day2Input parse_day2(std::string_view text)
+{
+	// Empty lines are no reports, an empty row would count as safe
+	Day2Input rows;
+	for (const auto line : utils::lines(text)) {
+		const auto values = rows.values().size();
+		utils::IntScanner scanner(line);
+		for (int level; scanner.next(level);) {
+			rows.push_value(level);
+		}
+		if (rows.values().size() != values) {
+			rows.end_row();
+		}
+	}
+	return rows;
+}
+
+int solve_day2(int part, const Day2Input& rows)
+{
+	if (part != 1 && part != 2) {
+		throw std::logic_error(std::format("Unknown part {}", part));
+	}
+
+	// Blocks of rows are checked in parallel
+	constexpr std::size_t block_rows = 4096;
+	const auto blocks = (rows.rows() + block_rows - 1) / block_rows;
+
+	if (part == 1) {
+		// All rows of a block at once from the flat buffer
+		auto count_stable = [&](std::size_t block) {
+			const auto first = block * block_rows;
+			const auto count = std::min(block_rows, rows.rows() - first);
+			const auto offsets = rows.offsets().subspan(first, count + 1);
+			return static_cast<int>(utils::count_steps_in_band(rows.values(), offsets, 1, 3));
+		};
+		return utils::parallel_reduce(0, blocks, 1, 0, count_stable, std::plus<>{});
+	}
+
+	auto is_safe = [&](std::size_t row_idx) {
+		const auto row = rows[row_idx];
+		return row_is_stable(row) || row_is_stable_dampened(row) ? 1 : 0;
+	};
+	return utils::parallel_reduce(0, rows.rows(), block_rows, 0, is_safe, std::plus<>{});
+}
+
+int solve_day2(int part, std::string_view text)
+{
+	if (part != 1 && part != 2) {
+		throw std::logic_error(std::format("Unknown part {}", part));
+	}
+
+	// Every piece of lines is parsed and checked by one task, the levels of a report are only kept until the next line
+	const auto chunks = std::max<std::size_t>(text.size() / utils::parallel_parse_min_bytes, 1);
+	auto count_safe = [&](std::size_t chunk) {
+		std::vector<int> levels;
+		int safe = 0;
+		for (const auto line : utils::lines(utils::line_chunk(text, chunk, chunks))) {
+			levels.clear();
+			utils::IntScanner scanner(line);
+			for (int level; scanner.next(level);) {
+				levels.push_back(level);
+			}
+			// Empty lines are no reports
+			if (levels.empty()) {
+				continue;
+			}
+			safe += row_is_stable(levels) || (part == 2 && row_is_stable_dampened(levels)) ? 1 : 0;
+		}
+		return safe;
+	};
+	return utils::parallel_reduce(0, chunks, 1, 0, count_safe, std::plus<>{});
+}
+
+int solve_day2(int part, const std::filesystem::path& input_file)
+{
+	const utils::MappedFile file(input_file);
+	return solve_day2(part, file.view());
+}
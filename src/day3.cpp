@@ -0,0 +1,179 @@
+#include "common.h"
+#include "grammar.h"
+#include "scheduler.h"
+#include "simd.h"
+#include "solvers.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <format>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+
+namespace
+{
+using utils::grammar::Int;
+using utils::grammar::Lit;
+using utils::grammar::Pattern;
+using utils::grammar::starts_with_literal;
+
+// Product of mul(X,Y) with numbers of 1 to 3 digits at the start of the text. A small DFA whose state is the
+// number being read and its digit count, the numbers are accumulated while the digits are walked.
+std::optional<std::int64_t> match_mul(std::string_view text)
+{
+	if (!starts_with_literal(text, "mul(")) {
+		return std::nullopt;
+	}
+	std::int64_t numbers[2] = {0, 0};
+	int number = 0;
+	int digits = 0;
+	for (std::size_t pos = 4; pos < text.size(); ++pos) {
+		const char c = text[pos];
+		if (c >= '0' && c <= '9') {
+			if (++digits > 3) {
+				return std::nullopt;
+			}
+			numbers[number] = numbers[number] * 10 + (c - '0');
+		}
+		else if (digits == 0) {
+			return std::nullopt;
+		}
+		else if (c == ',' && number == 0) {
+			number = 1;
+			digits = 0;
+		}
+		else if (c == ')' && number == 1) {
+			return numbers[0] * numbers[1];
+		}
+		else {
+			return std::nullopt;
+		}
+	}
+	return std::nullopt;
+}
+
+// Instructions matched by the hand written matchers above
+struct HandWrittenInstructions
+{
+	static std::int64_t mul(std::string_view text) { return match_mul(text).value_or(0); }
+	static bool enables(std::string_view text) { return starts_with_literal(text, "do()"); }
+	static bool disables(std::string_view text) { return starts_with_literal(text, "don't()"); }
+};
+
+// Instructions matched by DFAs generated from their grammar
+struct GrammarInstructions
+{
+	using Mul = Pattern<Lit<"mul(">, Int<1, 3>, Lit<",">, Int<1, 3>, Lit<")">>;
+	using Do = Pattern<Lit<"do()">>;
+	using Dont = Pattern<Lit<"don't()">>;
+
+	static std::int64_t mul(std::string_view text)
+	{
+		const auto match = Mul::match(text);
+		return match ? match->values[0] * match->values[1] : 0;
+	}
+	static bool enables(std::string_view text) { return Do::match(text).has_value(); }
+	static bool disables(std::string_view text) { return Dont::match(text).has_value(); }
+};
+static_assert(GrammarInstructions::Mul::first_char == 'm' && GrammarInstructions::Do::first_char == 'd'
+              && GrammarInstructions::Dont::first_char == 'd');
+
+// Effect of a piece of memory on the do()/don't() state
+enum class Switch
+{
+	keep,
+	enable,
+	disable
+};
+
+// What a piece of memory adds to the sum, for both states it can be entered in. Summaries of neighbouring pieces
+// combine into the summary of the joined piece, so pieces can be scanned independently.
+struct Summary
+{
+	std::int64_t enabled_sum = 0;
+	std::int64_t disabled_sum = 0;
+	// The last switch in the piece
+	Switch last = Switch::keep;
+};
+
+// State after the piece when it is entered in the given state
+bool leaves_enabled(const Summary& summary, bool enabled)
+{
+	return summary.last == Switch::keep ? enabled : summary.last == Switch::enable;
+}
+
+Summary combine(const Summary& left, const Summary& right)
+{
+	auto right_sum = [&](bool enabled) { return leaves_enabled(left, enabled) ? right.enabled_sum : right.disabled_sum; };
+	return {left.enabled_sum + right_sum(true), left.disabled_sum + right_sum(false),
+	        right.last == Switch::keep ? left.last : right.last};
+}
+
+// Summary of the instructions starting in [begin, end) of the memory. Only positions of 'm' and 'd' can start an
+// instruction, they are found 64 bytes at a time with a byte compare mask. An instruction may run past end, it is
+// matched against the rest of the memory, so the piece it starts in counts it. do() and don't() are skipped unless
+// use_switches.
+template <typename Instructions>
+Summary scan_memory(std::string_view memory, std::size_t begin, std::size_t end, bool use_switches)
+{
+	Summary summary;
+	for (std::size_t block = begin; block < end; block += 64) {
+		for (auto mask = utils::byte_mask(memory.substr(block, std::min<std::size_t>(64, end - block)), 'm', 'd');
+		     mask != 0; mask &= mask - 1) {
+			const auto rest = memory.substr(block + static_cast<std::size_t>(std::countr_zero(mask)));
+			if (rest[0] == 'm') {
+				if (summary.last != Switch::disable) {
+					const auto product = Instructions::mul(rest);
+					summary.enabled_sum += product;
+					summary.disabled_sum += summary.last == Switch::enable ? product : 0;
+				}
+			}
+			else if (use_switches) {
+				if (Instructions::enables(rest)) {
+					summary.last = Switch::enable;
+				}
+				else if (Instructions::disables(rest)) {
+					summary.last = Switch::disable;
+				}
+			}
+		}
+	}
+	return summary;
+}
+
+template <typename Instructions>
+std::int64_t solve(int part, std::string_view memory)
+{
+	if (part != 1 && part != 2) {
+		throw std::logic_error(std::format("Unknown part {}", part));
+	}
+
+	// Pieces are scanned in parallel and their summaries combined in order
+	constexpr auto piece_size = utils::parallel_parse_min_bytes;
+	static_assert(piece_size % 64 == 0, "Pieces consist of whole blocks");
+	auto scan_piece = [&](std::size_t piece) {
+		const auto begin = piece * piece_size;
+		return scan_memory<Instructions>(memory, begin, std::min(begin + piece_size, memory.size()), part == 2);
+	};
+	const auto pieces = (memory.size() + piece_size - 1) / piece_size;
+	return utils::parallel_reduce(0, pieces, 1, Summary{}, scan_piece, combine).enabled_sum;
+}
+}  // namespace
+
+std::int64_t solve_day3(int part, std::string_view memory)
+{
+	return solve<HandWrittenInstructions>(part, memory);
+}
+
+std::int64_t solve_day3_grammar(int part, std::string_view memory)
+{
+	return solve<GrammarInstructions>(part, memory);
+}
+
+std::int64_t solve_day3(int part, const std::filesystem::path& input_file)
+{
+	const utils::MappedFile file(input_file);
+	return solve_day3(part, file.view());
+}
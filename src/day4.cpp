@@ -0,0 +1,98 @@
+#include "bitplane.h"
+#include "common.h"
+#include "grid.h"
+#include "solvers.h"
+#include "tiling.h"
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <span>
+#include <stdexcept>
+
+Day4Input parse_day4(std::string_view text)
+{
+	return utils::load_grid(text);
+}
+
+namespace
+{
+// Number of cells in the first anchor_rows rows from which the letters of the planes follow each other in steps of
+// (drow, dcol). All 64 cells of a plane word are checked at once by ANDing the planes shifted by the column offset
+// of every letter.
+int count_word(std::span<const utils::BitPlane* const> letters, std::size_t drow, int dcol, std::size_t anchor_rows)
+{
+	const auto rows = letters.front()->rows();
+	const auto reach = (letters.size() - 1) * drow;
+	int count = 0;
+	for (std::size_t row = 0; row < anchor_rows && row + reach < rows; ++row) {
+		for (std::size_t word = 0; word < letters.front()->words(); ++word) {
+			auto bits = ~std::uint64_t{0};
+			for (std::size_t idx = 0; idx < letters.size(); ++idx) {
+				bits &= letters[idx]->bits(row + idx * drow, word, static_cast<int>(idx) * dcol);
+			}
+			count += std::popcount(bits);
+		}
+	}
+	return count;
+}
+
+// Words and crosses of one band, anchored at their top row. The planes cover the band and the rows below it which
+// the words reach.
+int count_band(int part, const Day4Input& grid, const utils::RowBand& band)
+{
+	// Part 2 does not look at X
+	const auto x = part == 1 ? utils::BitPlane(grid, 'X', band.first, band.halo_last) : utils::BitPlane();
+	const utils::BitPlane m(grid, 'M', band.first, band.halo_last);
+	const utils::BitPlane a(grid, 'A', band.first, band.halo_last);
+	const utils::BitPlane s(grid, 'S', band.first, band.halo_last);
+	const auto anchors = band.last - band.first;
+
+	if (part == 1) {
+		// XMAS forwards and backwards along rows, columns, diagonals and anti-diagonals
+		int xmas = 0;
+		for (const auto& word : {std::array{&x, &m, &a, &s}, std::array{&s, &a, &m, &x}}) {
+			xmas += count_word(word, 0, 1, anchors) + count_word(word, 1, 0, anchors) + count_word(word, 1, 1, anchors)
+			        + count_word(word, 1, -1, anchors);
+		}
+		return xmas;
+	}
+
+	// Crosses of MAS anchored at the top left corner of their 3x3 box, with the A in the middle
+	int xmas = 0;
+	for (std::size_t row = 0; row < anchors && row + 2 < a.rows(); ++row) {
+		for (std::size_t word = 0; word < a.words(); ++word) {
+			const auto diagonal = (m.bits(row, word, 0) & s.bits(row + 2, word, 2))
+			                      | (s.bits(row, word, 0) & m.bits(row + 2, word, 2));
+			const auto anti_diagonal = (m.bits(row, word, 2) & s.bits(row + 2, word, 0))
+			                           | (s.bits(row, word, 2) & m.bits(row + 2, word, 0));
+			xmas += std::popcount(a.bits(row + 1, word, 1) & diagonal & anti_diagonal);
+		}
+	}
+	return xmas;
+}
+}  // namespace
+
+int solve_day4(int part, const Day4Input& grid)
+{
+	if (part != 1 && part != 2) {
+		throw std::logic_error(std::format("Unknown part {}", part));
+	}
+	// Bands are counted in parallel, words reach at most 3 rows below their anchor
+	return utils::parallel_bands(grid, 3, 0, [&](const utils::RowBand& band) { return count_band(part, grid, band); },
+	                             std::plus<>{});
+}
+
+int solve_day4(int part, std::string_view text)
+{
+	return solve_day4(part, parse_day4(text));
+}
+
+int solve_day4(int part, const std::filesystem::path& input_file)
+{
+	const utils::MappedFile file(input_file);
+	return solve_day4(part, file.view());
+}
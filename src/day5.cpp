@@ -0,0 +1,116 @@
+#include "common.h"
+#include "solvers.h"
+
+#include <algorithm>
+#include <format>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+bool is_ordered(const std::vector<std::pair<int, int>>& order_rules, std::span<const int> update)
+{
+	bool ok = true;
+	for (const auto& [a, b] : order_rules) {
+		const auto aIt = std::ranges::find(update, a);
+		if (aIt != update.end()) {
+			const auto bIt = std::ranges::find(update, b);
+			if (bIt != update.end()) {
+				if (std::distance(aIt, bIt) < 0) {
+					ok = false;
+					break;
+				}
+			}
+		}
+	}
+	return ok;
+}
+
+void swap_wrong(const std::vector<std::pair<int, int>>& order_rules, std::vector<int>& update)
+{
+	for (std::size_t i = 0; i < update.size() - 1; ++i) {
+		auto goodOrderIt = std::ranges::find(order_rules, std::make_pair(update[i], update[i + 1]));
+		if (goodOrderIt == order_rules.end()) {
+			auto wrongOrderIt = std::ranges::find(order_rules, std::make_pair(update[i + 1], update[i]));
+			if (wrongOrderIt != order_rules.end()) {
+				std::swap(update[i], update[i + 1]);
+			}
+		}
+	}
+}
+
+Day5Input parse_day5(std::string_view text)
+{
+	bool read_pairs = true;
+	Day5Input input;
+	auto& order_rules = input.order_rules;
+	auto& updates = input.updates;
+	for (const auto line : utils::lines(text)) {
+		if (!line.empty()) {
+			if (read_pairs) {
+				const auto pos = line.find('|');
+				order_rules.emplace_back(utils::to_int<int>(line.substr(0, pos)), utils::to_int<int>(line.substr(pos + 1)));
+			}
+			else {
+				utils::IntScanner scanner(line);
+				for (int num; scanner.next(num);) {
+					updates.push_value(num);
+				}
+				updates.end_row();
+			}
+		}
+		else {
+			read_pairs = false;
+		}
+	}
+	return input;
+}
+
+int solve_day5(int part, const Day5Input& input)
+{
+	const auto& [order_rules, updates] = input;
+
+	// Verify rules over updates
+	int result = 0;
+	std::size_t update_idx = 0;
+	std::vector<std::size_t> wrong_updates;
+	for (const auto& update : updates) {
+		if (is_ordered(order_rules, update)) {
+			result += update[update.size() / 2];
+		}
+		else {
+			wrong_updates.emplace_back(update_idx);
+		}
+		++update_idx;
+	}
+
+	if (part == 1) {
+		return result;
+	}
+	
+	else if (part == 2) {
+		result = 0;
+		// Fix wrong updates
+		for (const auto idx : wrong_updates) {
+			std::vector<int> update(updates[idx].begin(), updates[idx].end());
+			while (!is_ordered(order_rules, update)) {
+				swap_wrong(order_rules, update);
+			}
+			result += update[update.size() / 2];
+		}
+		return result;
+	}
+	throw std::logic_error(std::format("Unknown part {}", part));
+}
+
+int solve_day5(int part, std::string_view text)
+{
+	return solve_day5(part, parse_day5(text));
+}
+
+int solve_day5(int part, const std::filesystem::path& input_file)
+{
+	const utils::MappedFile file(input_file);
+	return solve_day5(part, file.view());
+}
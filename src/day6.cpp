@@ -0,0 +1,120 @@
+#include "common.h"
+#include "grid.h"
+#include "scheduler.h"
+#include "solvers.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <stdexcept>
+
+enum class Direction
+{
+	up = 0,
+	right,
+	down,
+	left
+};
+
+// Value of the border cells around the field
+constexpr char outside = '\0';
+
+// Position which is never inside the field
+constexpr std::size_t no_obstacle = static_cast<std::size_t>(-1);
+
+// Returns true if there is a way out, false otherwise. The obstacle position is treated as an extra barrier.
+bool find_way_out(std::size_t cur_pos, const utils::Grid<char>& field, std::size_t obstacle, int& visited_fields)
+{
+	// Offsets of the next field in the buffer for each direction. Negative steps wrap around, which is well defined
+	// for unsigned arithmetic and yields the right position.
+	const auto stride = static_cast<std::size_t>(field.stride());
+	const std::array<std::size_t, 4> steps{0 - stride, 1, stride, 0 - std::size_t{1}};
+	Direction cur_direction = Direction::up;
+	// Directions in which each field was entered, one bit per direction
+	utils::Grid<std::uint8_t> visited(field.rows(), field.cols(), 0, field.border(), 0);
+	bool loop_detected = false;
+	while (true) {
+		const auto next_pos = cur_pos + steps[static_cast<int>(cur_direction)];
+
+		// Is it the end?
+		if (field[next_pos] == outside) {
+			// Next position is out of field. End.
+			break;
+		}
+
+		// There is barier - change direction and stay on the same field
+		if (field[next_pos] == '#' || next_pos == obstacle) {
+			cur_direction = static_cast<Direction>((static_cast<int>(cur_direction) + 1) % 4);
+			continue;
+		}
+
+		// Loop protection
+		const auto direction_bit = static_cast<std::uint8_t>(1 << static_cast<int>(cur_direction));
+		if (visited[next_pos] & direction_bit) {
+			loop_detected = true;
+			break;
+		}
+
+		// Normal field
+		visited[next_pos] |= direction_bit;
+		cur_pos = next_pos;
+	}
+
+	// Sum all visited fields
+	visited_fields = static_cast<int>(std::ranges::count_if(visited.cells(), [](auto val) { return val != 0; }));
+
+	return !loop_detected;
+}
+
+Day6Input parse_day6(std::string_view text)
+{
+	return utils::load_grid(text, 1, outside);
+}
+
+int solve_day6(int part, const Day6Input& field)
+{
+	const auto start = field.find('^');
+	if (!start) {
+		throw std::logic_error(std::format("No starting position"));
+	}
+	const auto cur_pos = field.index(start->first, start->second);
+
+	if (part == 1) {
+		int result = 0;
+		if (find_way_out(cur_pos, field, no_obstacle, result)) {
+			return result;
+		}
+		throw std::logic_error(std::format("Cannot finnish the task"));
+	}
+
+	if (part == 2) {
+		// Rows are searched in parallel, the field is shared and only read
+		auto count_loops = [&](std::size_t row_idx) {
+			int loops = 0;
+			int visited_fields = 0;
+			for (std::size_t col_idx = 0; col_idx < field.cols(); ++col_idx) {
+				// Place an extra obstacle and try to find if there will be a loop
+				if (field(row_idx, col_idx) == '.'
+				    && !find_way_out(cur_pos, field, field.index(row_idx, col_idx), visited_fields)) {
+					++loops;
+				}
+			}
+			return loops;
+		};
+		return utils::parallel_reduce(0, field.rows(), 1, 0, count_loops, std::plus<>{});
+	}
+	throw std::logic_error(std::format("Unknown part {}", part));
+}
+
+int solve_day6(int part, std::string_view text)
+{
+	return solve_day6(part, parse_day6(text));
+}
+
+int solve_day6(int part, const std::filesystem::path& input_file)
+{
+	const utils::MappedFile file(input_file);
+	return solve_day6(part, file.view());
+}
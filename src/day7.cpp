@@ -0,0 +1,100 @@
+#include "common.h"
+#include "scheduler.h"
+#include "solvers.h"
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+enum class Operation {
+	mul,
+	add,
+	join
+};
+
+void get_combinations(std::size_t sampleCount,
+                      const std::vector<Operation>& options,
+                      std::vector<Operation>& stack,
+                      std::vector<std::vector<Operation>>& opers)
+{
+	if (stack.size() == sampleCount) {
+		opers.push_back(stack);
+	}
+	else {
+		// Add a new number, iterate over all possibilities
+		stack.push_back(Operation::mul);
+		for (auto op : options) {
+			stack.back() = op;
+			get_combinations(sampleCount, options, stack, opers);
+		}
+		stack.pop_back();
+	}
+}
+
+Day7Input parse_day7(std::string_view text)
+{
+	Day7Input equations;
+	for (const auto line : utils::lines(text)) {
+		const auto pos_dd = line.find(':');
+		equations.results.push_back(utils::to_int<std::int64_t>(line.substr(0, pos_dd)));
+		utils::IntScanner scanner(line.substr(pos_dd + 1));
+		for (int n; scanner.next(n);) {
+			equations.nums.push_value(n);
+		}
+		equations.nums.end_row();
+	}
+	return equations;
+}
+
+std::int64_t solve_day7(int part, const Day7Input& input)
+{
+	// Test value of the equation if it can be made true, 0 otherwise. Equations are checked in parallel.
+	auto calibration = [&](std::size_t idx) -> std::int64_t {
+		const auto res = input.results[idx];
+		const auto nums = input.nums[idx];
+		std::vector<Operation> stack;
+		std::vector<std::vector<Operation>> opers_list;
+		if (part == 1) {
+			get_combinations(nums.size() - 1, {Operation::mul, Operation::add}, stack, opers_list);
+		}
+		else {
+			get_combinations(nums.size() - 1, {Operation::mul, Operation::add, Operation::join}, stack, opers_list);
+		}
+		bool res_found = false;
+		for (const auto& opers : opers_list) {
+			std::int64_t val = nums[0];
+			for (std::size_t i = 1; i < nums.size(); ++i) {
+				if (opers[i - 1] == Operation::mul) {
+					val *= nums[i];
+				}
+				else if (opers[i - 1] == Operation::add) {
+					val += nums[i];
+				}
+				else if (opers[i - 1] == Operation::join) {
+					std::int64_t shift = 10;
+					while (shift <= nums[i]) {
+						shift *= 10;
+					}
+					val = val * shift + nums[i];
+				}
+			}
+			if (val == res) {
+				res_found = true;
+				break;
+			}
+		}
+		return res_found ? res : 0;
+	};
+	return utils::parallel_reduce(0, input.results.size(), 4, std::int64_t{0}, calibration, std::plus<>{});
+}
+
+std::int64_t solve_day7(int part, std::string_view text)
+{
+	return solve_day7(part, parse_day7(text));
+}
+
+std::int64_t solve_day7(int part, const std::filesystem::path& input_file)
+{
+	const utils::MappedFile file(input_file);
+	return solve_day7(part, file.view());
+}
@@ -0,0 +1,80 @@
+#include "common.h"
+#include "grid.h"
+#include "solvers.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <format>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+Day8Input parse_day8(std::string_view text)
+{
+	return utils::load_grid(text);
+}
+
+std::int64_t solve_day8(int part, const Day8Input& grid)
+{
+	if (part != 1 && part != 2) {
+		throw std::logic_error(std::format("Unknown part {}", part));
+	}
+
+	// Load indices of antennas
+	std::unordered_map<char, std::vector<std::pair<int, int>>> ant_idx_map;
+	for (std::size_t row_idx = 0; row_idx < grid.rows(); ++row_idx) {
+		for (std::size_t col_idx = 0; col_idx < grid.cols(); ++col_idx) {
+			const char c = grid(row_idx, col_idx);
+			if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9')) {
+				ant_idx_map[c].push_back({row_idx, col_idx});
+			}
+		}
+	}
+
+	// Mark antinodes positions
+	utils::Grid<std::uint8_t> antinodes(grid.rows(), grid.cols());
+	for (const auto& ant_idx: ant_idx_map) {
+		for (const auto& ant: ant_idx.second) {
+			for (const auto& ant2 : ant_idx.second) {
+				if (ant != ant2) {
+					int x = ant.first + ant.first - ant2.first;
+					int y = ant.second + ant.second - ant2.second;
+					if (part == 1) {
+						if (grid.in_bounds(x, y)) {
+							antinodes(x, y) = 1;
+						}
+					}
+					else {
+						auto difx = ant.first - ant2.first;
+						auto dify = ant.second - ant2.second;
+						while (grid.in_bounds(x, y)) {
+							antinodes(x, y) = 1;
+							x += difx;
+							y += dify;
+						}
+						x = ant2.first;
+						y = ant2.second;
+						while (grid.in_bounds(x, y)) {
+							antinodes(x, y) = 1;
+							x -= difx;
+							y -= dify;
+						}
+					}
+				}
+			}
+		}
+	}
+	return std::ranges::count(antinodes.cells(), 1);
+}
+
+std::int64_t solve_day8(int part, std::string_view text)
+{
+	return solve_day8(part, parse_day8(text));
+}
+
+std::int64_t solve_day8(int part, const std::filesystem::path& input_file)
+{
+	const utils::MappedFile file(input_file);
+	return solve_day8(part, file.view());
+}
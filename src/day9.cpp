@@ -0,0 +1,112 @@
+#include "common.h"
+#include "solvers.h"
+
+#include <algorithm>
+#include <format>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+
+Day9Input parse_day9(std::string_view text)
+{
+	const std::string_view input_data = *utils::lines(text).begin();
+	Day9Input input;
+	auto& disk = input.disk;
+	std::int64_t file_id = 0;
+	std::string_view::iterator it = input_data.begin();
+	while (it != input_data.end()) {
+		std::uint8_t sz = *it - '0';
+		++it;
+		std::uint8_t gap = 0;
+		if (it != input_data.end()) {
+			gap = *it - '0';
+			++it;
+		}
+		disk.reserve(disk.size() + sz + gap);
+		for (std::uint8_t i = 0; i < sz; ++i) {
+			disk.push_back(file_id);
+		}
+		for (std::uint8_t i = 0; i < gap; ++i) {
+			disk.push_back({});
+		}
+		++file_id;
+	}
+	input.file_count = file_id;
+	return input;
+}
+
+std::int64_t solve_day9(int part, Day9Input input)
+{
+	auto& disk = input.disk;
+	auto file_id = input.file_count;
+	if (part == 1) {
+		auto id_to_move = disk.end() - 1;
+		auto blank = std::find(disk.begin(), disk.end(), std::nullopt);
+		while (id_to_move > blank) {
+			std::swap(*blank, *id_to_move);
+			while (!(--id_to_move)->has_value())
+				;
+			while ((++blank)->has_value())
+				;
+		}
+
+		std::int64_t checksum = 0;
+		for (std::size_t idx = 0; idx < disk.size(); ++idx) {
+			if (!disk[idx].has_value()) {
+				break;
+			}
+			checksum += idx * disk[idx].value();
+		}
+		return checksum;
+	}
+	else if (part == 2) {
+		--file_id;
+		for (;file_id >= 0; --file_id) {
+			auto fid_start = std::find(disk.begin(), disk.end(), file_id);
+			auto fid_end = fid_start + 1;
+			while (fid_end != disk.end() && fid_end->has_value() && fid_end->value() == file_id) {
+				++fid_end;
+			}
+			auto fsize = std::distance(fid_start, fid_end);
+			auto gap_start = std::find(disk.begin(), fid_start, std::nullopt);
+			while (gap_start < fid_start) {
+				auto gap_end = gap_start + 1;
+				while (gap_end < fid_start && !gap_end->has_value()) {
+					++gap_end;
+				}
+				auto gap_size = std::distance(gap_start, gap_end);
+				if (gap_size >= fsize) {
+					for (ptrdiff_t i = 0; i < fsize; ++i) {
+						std::swap(*(fid_start + i), *(gap_start + i));
+					}
+					break;
+				}
+				if (gap_end + 1 < fid_start) {
+					gap_start = std::find(gap_end + 1, fid_start, std::nullopt);
+				}
+				else {
+					break;
+				}
+			}
+		}
+		std::int64_t checksum = 0;
+		for (std::size_t idx = 0; idx < disk.size(); ++idx) {
+			if (disk[idx].has_value()) {
+				checksum += idx * disk[idx].value();
+			}
+		}
+		return checksum;
+	}
+	throw std::logic_error(std::format("Unknown part {}", part));
+}
+
+std::int64_t solve_day9(int part, std::string_view text)
+{
+	return solve_day9(part, parse_day9(text));
+}
+
+std::int64_t solve_day9(int part, const std::filesystem::path& input_file)
+{
+	const utils::MappedFile file(input_file);
+	return solve_day9(part, file.view());
+}
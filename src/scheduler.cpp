@@ -0,0 +1,200 @@
+#include "scheduler.h"
+
+#include <algorithm>
+
+namespace utils
+{
+namespace
+{
+// Scheduler and queue of the worker running on this thread
+thread_local const Scheduler* current_scheduler = nullptr;
+thread_local std::size_t current_queue = 0;
+
+// Threads outside of a scheduler are spread over its external queues by the order of their first loop
+std::atomic<std::size_t> next_external_slot{0};
+thread_local const std::size_t external_slot = next_external_slot.fetch_add(1, std::memory_order_relaxed);
+
+// The pointer makes the common call a single load, the mutex only guards creating and replacing the instance
+std::mutex default_mutex;
+std::unique_ptr<Scheduler> default_instance;
+std::atomic<Scheduler*> default_pointer{nullptr};
+}  // namespace
+
+Scheduler::Scheduler(std::size_t threads)
+{
+	if (threads == 0) {
+		threads = std::max(1u, std::thread::hardware_concurrency());
+	}
+	// One queue per worker and as many for threads outside of the scheduler
+	m_worker_queues = threads - 1;
+	m_queue_count = m_worker_queues + threads;
+	m_queues = std::make_unique<Queue[]>(m_queue_count);
+	m_workers.reserve(threads - 1);
+	for (std::size_t idx = 0; idx + 1 < threads; ++idx) {
+		m_workers.emplace_back([this, idx] { work(idx); });
+	}
+}
+
+Scheduler::~Scheduler()
+{
+	{
+		std::lock_guard lock(m_sleep_mutex);
+		m_stop = true;
+	}
+	m_wake.notify_all();
+	for (auto& worker : m_workers) {
+		worker.join();
+	}
+}
+
+std::size_t Scheduler::own_queue() const
+{
+	if (current_scheduler == this) {
+		return current_queue;
+	}
+	return m_worker_queues + external_slot % (m_queue_count - m_worker_queues);
+}
+
+void Scheduler::execute(Loop& loop, std::size_t begin, std::size_t end)
+{
+	const auto queue = own_queue();
+	run_task({&loop, begin, end}, queue);
+	// Help with any queued work until the other threads finished their parts of the loop. Without work to take
+	// the thread sleeps until a range is pushed or the last part of the loop finishes.
+	Task task;
+	while (loop.remaining.load() != 0) {
+		if (take(queue, task)) {
+			run_task(task, queue);
+			continue;
+		}
+		std::unique_lock lock(m_sleep_mutex);
+		m_sleeping.fetch_add(1);
+		m_waiting.fetch_add(1);
+		m_wake.wait(lock, [&] { return loop.remaining.load() == 0 || m_pending.load() != 0; });
+		m_waiting.fetch_sub(1);
+		m_sleeping.fetch_sub(1);
+	}
+	if (loop.error) {
+		std::rethrow_exception(loop.error);
+	}
+}
+
+void Scheduler::run_task(Task task, std::size_t queue)
+{
+	Loop& loop = *task.loop;
+	// Keep the lower half and offer the upper half to other threads until the range is small enough
+	while (task.last - task.first > loop.grain) {
+		const auto middle = task.first + (task.last - task.first) / 2;
+		push(queue, {&loop, middle, task.last});
+		task.last = middle;
+	}
+	if (!loop.failed.load(std::memory_order_relaxed)) {
+		try {
+			loop.run(loop.context, task.first, task.last);
+		}
+		catch (...) {
+			std::lock_guard lock(loop.error_mutex);
+			if (!loop.error) {
+				loop.error = std::current_exception();
+			}
+			loop.failed = true;
+		}
+	}
+	// The loop may be gone once remaining is zero, only the scheduler is used after the decrement
+	const auto count = task.last - task.first;
+	if (loop.remaining.fetch_sub(count) == count && m_waiting.load() != 0) {
+		{
+			std::lock_guard lock(m_sleep_mutex);
+		}
+		m_wake.notify_all();
+	}
+}
+
+void Scheduler::push(std::size_t queue, Task task)
+{
+	{
+		std::lock_guard lock(m_queues[queue].mutex);
+		m_queues[queue].tasks.push_back(task);
+	}
+	m_pending.fetch_add(1);
+	if (m_sleeping.load() != 0) {
+		// Taking the lock orders the notification after a worker checked m_pending and went to sleep
+		{
+			std::lock_guard lock(m_sleep_mutex);
+		}
+		m_wake.notify_one();
+	}
+}
+
+bool Scheduler::take(std::size_t queue, Task& task)
+{
+	if (m_pending.load() == 0) {
+		return false;
+	}
+	// Newest range of the own queue first, it is the smallest one and its data is likely still in the cache
+	{
+		auto& own = m_queues[queue];
+		std::lock_guard lock(own.mutex);
+		if (!own.tasks.empty()) {
+			task = own.tasks.back();
+			own.tasks.pop_back();
+			m_pending.fetch_sub(1);
+			return true;
+		}
+	}
+	// Then steal the oldest range of another queue
+	for (std::size_t offset = 1; offset < m_queue_count; ++offset) {
+		auto& victim = m_queues[(queue + offset) % m_queue_count];
+		std::lock_guard lock(victim.mutex);
+		if (!victim.tasks.empty()) {
+			task = victim.tasks.front();
+			victim.tasks.pop_front();
+			m_pending.fetch_sub(1);
+			return true;
+		}
+	}
+	return false;
+}
+
+void Scheduler::work(std::size_t index)
+{
+	current_scheduler = this;
+	current_queue = index;
+	Task task;
+	while (true) {
+		if (take(index, task)) {
+			run_task(task, index);
+			continue;
+		}
+		std::unique_lock lock(m_sleep_mutex);
+		m_sleeping.fetch_add(1);
+		m_wake.wait(lock, [this] { return m_stop || m_pending.load() != 0; });
+		m_sleeping.fetch_sub(1);
+		if (m_stop) {
+			return;
+		}
+	}
+}
+
+Scheduler& default_scheduler()
+{
+	if (auto* scheduler = default_pointer.load(std::memory_order_acquire)) {
+		return *scheduler;
+	}
+	std::lock_guard lock(default_mutex);
+	if (!default_instance) {
+		default_instance = std::make_unique<Scheduler>();
+		default_pointer.store(default_instance.get(), std::memory_order_release);
+	}
+	return *default_instance;
+}
+
+void set_default_threads(std::size_t threads)
+{
+	std::lock_guard lock(default_mutex);
+	auto replacement = std::make_unique<Scheduler>(threads);
+	default_pointer.store(replacement.get(), std::memory_order_release);
+	default_instance = std::move(replacement);
+}
+
+}  // namespace utils
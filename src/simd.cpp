@@ -0,0 +1,335 @@
+#include "simd.h"
+
+#include <algorithm>
+#include <cstddef>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define AOC2024_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+// MSVC accepts AVX2 intrinsics without extra compiler flags
+#define AOC2024_TARGET_AVX2
+#else
+#define AOC2024_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace
+{
+using Kernel = std::int64_t (*)(const int* a, const int* b, std::size_t size);
+using BandKernel = bool (*)(const int* values, std::size_t size, int min_step, int max_step);
+using BandCountKernel = std::size_t (*)(std::span<const int> values,
+                                        std::span<const std::size_t> offsets,
+                                        int min_step,
+                                        int max_step);
+using ByteMaskKernel = std::uint64_t (*)(const char* data, std::size_t size, char a, char b);
+
+std::int64_t sum_abs_diff_portable(const int* a, const int* b, std::size_t size)
+{
+	std::int64_t sum = 0;
+	for (std::size_t idx = 0; idx < size; ++idx) {
+		// max - min fits into 32 bits as an unsigned value even when a - b overflows int
+		sum += static_cast<std::uint32_t>(std::max(a[idx], b[idx]))
+		       - static_cast<std::uint32_t>(std::min(a[idx], b[idx]));
+	}
+	return sum;
+}
+
+std::int64_t dot_product_portable(const int* a, const int* b, std::size_t size)
+{
+	std::int64_t sum = 0;
+	for (std::size_t idx = 0; idx < size; ++idx) {
+		sum += static_cast<std::int64_t>(a[idx]) * b[idx];
+	}
+	return sum;
+}
+
+bool steps_in_band_portable(const int* values, std::size_t size, int min_step, int max_step)
+{
+	bool increasing = true;
+	bool decreasing = true;
+	for (std::size_t idx = 1; idx < size && (increasing || decreasing); ++idx) {
+		const auto step = values[idx] - values[idx - 1];
+		increasing = increasing && step >= min_step && step <= max_step;
+		decreasing = decreasing && step >= -max_step && step <= -min_step;
+	}
+	return increasing || decreasing;
+}
+
+std::size_t count_steps_in_band_portable(std::span<const int> values,
+                                         std::span<const std::size_t> offsets,
+                                         int min_step,
+                                         int max_step)
+{
+	std::size_t count = 0;
+	for (std::size_t row = 0; row + 1 < offsets.size(); ++row) {
+		const auto first = offsets[row];
+		count += steps_in_band_portable(values.data() + first, offsets[row + 1] - first, min_step, max_step) ? 1 : 0;
+	}
+	return count;
+}
+
+std::uint64_t byte_mask_portable(const char* data, std::size_t size, char a, char b)
+{
+	std::uint64_t mask = 0;
+	for (std::size_t idx = 0; idx < std::min<std::size_t>(size, 64); ++idx) {
+		mask |= static_cast<std::uint64_t>(data[idx] == a || data[idx] == b) << idx;
+	}
+	return mask;
+}
+
+// True if the bits [first, last) of the bit array are all set
+bool all_bits_set(const std::uint8_t* bits, std::size_t first, std::size_t last)
+{
+	for (std::size_t bit = first; bit < last;) {
+		if (bit % 8 == 0 && last - bit >= 8) {
+			if (bits[bit / 8] != 0xFF) {
+				return false;
+			}
+			bit += 8;
+			continue;
+		}
+		if (!(bits[bit / 8] & (1 << (bit % 8)))) {
+			return false;
+		}
+		++bit;
+	}
+	return true;
+}
+
+#if defined(AOC2024_X86)
+AOC2024_TARGET_AVX2 std::int64_t horizontal_sum(__m256i lanes)
+{
+	alignas(32) std::int64_t values[4];
+	_mm256_store_si256(reinterpret_cast<__m256i*>(values), lanes);
+	return values[0] + values[1] + values[2] + values[3];
+}
+
+AOC2024_TARGET_AVX2 std::int64_t sum_abs_diff_avx2(const int* a, const int* b, std::size_t size)
+{
+	__m256i sum = _mm256_setzero_si256();
+	std::size_t idx = 0;
+	for (; idx + 8 <= size; idx += 8) {
+		const auto va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + idx));
+		const auto vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + idx));
+		// Unsigned 32 bit differences, widened to 64 bit lanes
+		const auto diff = _mm256_sub_epi32(_mm256_max_epi32(va, vb), _mm256_min_epi32(va, vb));
+		sum = _mm256_add_epi64(sum, _mm256_cvtepu32_epi64(_mm256_castsi256_si128(diff)));
+		sum = _mm256_add_epi64(sum, _mm256_cvtepu32_epi64(_mm256_extracti128_si256(diff, 1)));
+	}
+	return horizontal_sum(sum) + sum_abs_diff_portable(a + idx, b + idx, size - idx);
+}
+
+AOC2024_TARGET_AVX2 std::int64_t dot_product_avx2(const int* a, const int* b, std::size_t size)
+{
+	__m256i sum = _mm256_setzero_si256();
+	std::size_t idx = 0;
+	for (; idx + 8 <= size; idx += 8) {
+		const auto va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + idx));
+		const auto vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + idx));
+		// _mm256_mul_epi32 multiplies the sign extended low halves of the 64 bit lanes
+		const auto low = _mm256_mul_epi32(_mm256_cvtepi32_epi64(_mm256_castsi256_si128(va)),
+		                                  _mm256_cvtepi32_epi64(_mm256_castsi256_si128(vb)));
+		const auto high = _mm256_mul_epi32(_mm256_cvtepi32_epi64(_mm256_extracti128_si256(va, 1)),
+		                                   _mm256_cvtepi32_epi64(_mm256_extracti128_si256(vb, 1)));
+		sum = _mm256_add_epi64(sum, _mm256_add_epi64(low, high));
+	}
+	return horizontal_sum(sum) + dot_product_portable(a + idx, b + idx, size - idx);
+}
+
+// Steps of 8 neighbouring pairs starting at values: lane masks of steps in the increasing and decreasing band
+struct BandMasks
+{
+	__m256i increasing;
+	__m256i decreasing;
+};
+
+AOC2024_TARGET_AVX2 BandMasks band_masks(const int* values, int min_step, int max_step)
+{
+	const auto steps = _mm256_sub_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + 1)),
+	                                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values)));
+	const auto above_min = _mm256_cmpgt_epi32(steps, _mm256_set1_epi32(min_step - 1));
+	const auto below_max = _mm256_cmpgt_epi32(_mm256_set1_epi32(max_step + 1), steps);
+	const auto above_neg_max = _mm256_cmpgt_epi32(steps, _mm256_set1_epi32(-max_step - 1));
+	const auto below_neg_min = _mm256_cmpgt_epi32(_mm256_set1_epi32(-min_step + 1), steps);
+	return {_mm256_and_si256(above_min, below_max), _mm256_and_si256(above_neg_max, below_neg_min)};
+}
+
+// One bit per 32 bit lane of the mask
+AOC2024_TARGET_AVX2 std::uint8_t lane_bits(__m256i mask)
+{
+	return static_cast<std::uint8_t>(_mm256_movemask_ps(_mm256_castsi256_ps(mask)));
+}
+
+AOC2024_TARGET_AVX2 bool steps_in_band_avx2(const int* values, std::size_t size, int min_step, int max_step)
+{
+	auto increasing = _mm256_set1_epi32(-1);
+	auto decreasing = _mm256_set1_epi32(-1);
+	std::size_t idx = 0;
+	// Pairs idx to idx + 7, the last one reads values[idx + 8]
+	for (; idx + 9 <= size; idx += 8) {
+		const auto masks = band_masks(values + idx, min_step, max_step);
+		increasing = _mm256_and_si256(increasing, masks.increasing);
+		decreasing = _mm256_and_si256(decreasing, masks.decreasing);
+		if (_mm256_testz_si256(increasing, increasing) && _mm256_testz_si256(decreasing, decreasing)) {
+			return false;
+		}
+	}
+	if (idx == 0) {
+		return steps_in_band_portable(values, size, min_step, max_step);
+	}
+	// The remaining pairs, overlapping with the checked ones
+	const auto masks = band_masks(values + size - 9, min_step, max_step);
+	increasing = _mm256_and_si256(increasing, masks.increasing);
+	decreasing = _mm256_and_si256(decreasing, masks.decreasing);
+	return lane_bits(increasing) == 0xFF || lane_bits(decreasing) == 0xFF;
+}
+
+AOC2024_TARGET_AVX2 std::size_t count_steps_in_band_avx2(std::span<const int> values,
+                                                         std::span<const std::size_t> offsets,
+                                                         int min_step,
+                                                         int max_step)
+{
+	// Band bits of a window of consecutive pairs of the flat buffer, pairs crossing rows are computed and ignored
+	constexpr std::size_t window = 4096;
+	std::uint8_t increasing[window / 8];
+	std::uint8_t decreasing[window / 8];
+
+	std::size_t count = 0;
+	const auto rows = offsets.empty() ? 0 : offsets.size() - 1;
+	for (std::size_t row = 0; row < rows;) {
+		const auto base = offsets[row];
+		const auto pairs = base + 1 < values.size() ? std::min(window, values.size() - 1 - base) : 0;
+		std::size_t pair = 0;
+		for (; pair + 8 <= pairs; pair += 8) {
+			const auto masks = band_masks(values.data() + base + pair, min_step, max_step);
+			increasing[pair / 8] = lane_bits(masks.increasing);
+			decreasing[pair / 8] = lane_bits(masks.decreasing);
+		}
+		if (pair < pairs) {
+			increasing[pair / 8] = 0;
+			decreasing[pair / 8] = 0;
+			for (; pair < pairs; ++pair) {
+				const auto step = values[base + pair + 1] - values[base + pair];
+				const auto bit = static_cast<std::uint8_t>(1 << (pair % 8));
+				increasing[pair / 8] |= step >= min_step && step <= max_step ? bit : 0;
+				decreasing[pair / 8] |= step >= -max_step && step <= -min_step ? bit : 0;
+			}
+		}
+
+		// Rows whose pairs all lie in the window
+		const auto first_row = row;
+		for (; row < rows && offsets[row + 1] <= base + pairs + 1; ++row) {
+			const auto first = offsets[row] - base;
+			const auto last = offsets[row + 1] - base;
+			if (last - first < 2 || all_bits_set(increasing, first, last - 1)
+			    || all_bits_set(decreasing, first, last - 1)) {
+				++count;
+			}
+		}
+		if (row == first_row) {
+			// Row longer than the window
+			count += steps_in_band_avx2(values.data() + base, offsets[row + 1] - base, min_step, max_step) ? 1 : 0;
+			++row;
+		}
+	}
+	return count;
+}
+
+// Bit mask of the 32 bytes equal to a or b
+AOC2024_TARGET_AVX2 std::uint32_t byte_mask_32(const char* data, __m256i a, __m256i b)
+{
+	const auto bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+	const auto equal = _mm256_or_si256(_mm256_cmpeq_epi8(bytes, a), _mm256_cmpeq_epi8(bytes, b));
+	return static_cast<std::uint32_t>(_mm256_movemask_epi8(equal));
+}
+
+AOC2024_TARGET_AVX2 std::uint64_t byte_mask_avx2(const char* data, std::size_t size, char a, char b)
+{
+	if (size < 64) {
+		return byte_mask_portable(data, size, a, b);
+	}
+	const auto va = _mm256_set1_epi8(a);
+	const auto vb = _mm256_set1_epi8(b);
+	return byte_mask_32(data, va, vb) | static_cast<std::uint64_t>(byte_mask_32(data + 32, va, vb)) << 32;
+}
+
+bool detect_avx2()
+{
+#if defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 1);
+	// The OS has to save the AVX registers (OSXSAVE and AVX bits, XMM and YMM state enabled)
+	const bool avx = (info[2] & (1 << 27)) && (info[2] & (1 << 28)) && (_xgetbv(0) & 6) == 6;
+	__cpuidex(info, 7, 0);
+	return avx && (info[1] & (1 << 5));
+#else
+	return __builtin_cpu_supports("avx2");
+#endif
+}
+#else
+bool detect_avx2()
+{
+	return false;
+}
+#endif
+
+struct Kernels
+{
+	Kernel sum_abs_diff;
+	Kernel dot_product;
+	BandKernel steps_in_band;
+	BandCountKernel count_steps_in_band;
+	ByteMaskKernel byte_mask;
+};
+
+const Kernels& kernels()
+{
+	static const Kernels selected = [] {
+#if defined(AOC2024_X86)
+		if (utils::has_avx2()) {
+			return Kernels{sum_abs_diff_avx2, dot_product_avx2, steps_in_band_avx2, count_steps_in_band_avx2,
+			               byte_mask_avx2};
+		}
+#endif
+		return Kernels{sum_abs_diff_portable, dot_product_portable, steps_in_band_portable,
+		               count_steps_in_band_portable, byte_mask_portable};
+	}();
+	return selected;
+}
+}  // namespace
+
+std::int64_t utils::sum_abs_diff(std::span<const int> a, std::span<const int> b)
+{
+	return kernels().sum_abs_diff(a.data(), b.data(), std::min(a.size(), b.size()));
+}
+
+std::int64_t utils::dot_product(std::span<const int> a, std::span<const int> b)
+{
+	return kernels().dot_product(a.data(), b.data(), std::min(a.size(), b.size()));
+}
+
+bool utils::steps_in_band(std::span<const int> values, int min_step, int max_step)
+{
+	return kernels().steps_in_band(values.data(), values.size(), min_step, max_step);
+}
+
+std::size_t utils::count_steps_in_band(std::span<const int> values,
+                                       std::span<const std::size_t> offsets,
+                                       int min_step,
+                                       int max_step)
+{
+	return kernels().count_steps_in_band(values, offsets, min_step, max_step);
+}
+
+std::uint64_t utils::byte_mask(std::string_view block, char a, char b)
+{
+	return kernels().byte_mask(block.data(), block.size(), a, b);
+}
+
+bool utils::has_avx2()
+{
+	static const bool supported = detect_avx2();
+	return supported;
+}
@@ -0,0 +1,61 @@
+#include "thread_pool.h"
+
+#include <algorithm>
+
+namespace utils
+{
+namespace
+{
+// Pool and index of the worker running on this thread
+thread_local const ThreadPool* current_pool = nullptr;
+thread_local std::size_t current_index = 0;
+}  // namespace
+
+ThreadPool::ThreadPool(std::size_t threads)
+{
+	if (threads == 0) {
+		threads = std::max(1u, std::thread::hardware_concurrency());
+	}
+	m_workers.reserve(threads);
+	for (std::size_t idx = 0; idx < threads; ++idx) {
+		m_workers.emplace_back([this, idx] { work(idx); });
+	}
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard lock(m_mutex);
+		m_stop = true;
+	}
+	m_wake.notify_all();
+	for (auto& worker : m_workers) {
+		worker.join();
+	}
+}
+
+std::size_t ThreadPool::worker_index() const
+{
+	return current_pool == this ? current_index : size();
+}
+
+void ThreadPool::work(std::size_t index)
+{
+	current_pool = this;
+	current_index = index;
+	while (true) {
+		std::move_only_function<void()> task;
+		{
+			std::unique_lock lock(m_mutex);
+			m_wake.wait(lock, [this] { return m_stop || !m_tasks.empty(); });
+			if (m_tasks.empty()) {
+				return;
+			}
+			task = std::move(m_tasks.front());
+			m_tasks.pop_front();
+		}
+		task();
+	}
+}
+
+}  // namespace utils
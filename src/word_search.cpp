@@ -0,0 +1,115 @@
+#include "word_search.h"
+
+#include <stdexcept>
+
+namespace utils
+{
+WordSearch::WordSearch(std::span<const std::string_view> words)
+{
+	for (const auto word : words) {
+		if (word.empty()) {
+			throw std::invalid_argument("Empty word");
+		}
+		for (const char c : word) {
+			auto& byte_class = m_class[static_cast<unsigned char>(c)];
+			byte_class = byte_class == 0 ? static_cast<std::uint16_t>(m_classes++) : byte_class;
+		}
+	}
+
+	// Trie of the words, 0 marks a missing child as the root is nobody's child
+	m_next.assign(m_classes, 0);
+	for (const auto word : words) {
+		std::uint32_t state = 0;
+		for (const char c : word) {
+			auto next = m_next[state * m_classes + m_class[static_cast<unsigned char>(c)]];
+			if (next == 0) {
+				next = static_cast<std::uint32_t>(m_next.size() / m_classes);
+				m_next[state * m_classes + m_class[static_cast<unsigned char>(c)]] = next;
+				m_next.resize(m_next.size() + m_classes, 0);
+			}
+			state = next;
+		}
+		m_word_end.push_back(state);
+	}
+
+	// Breadth first, the suffix link of a child is the transition of the parent's suffix. Missing children take
+	// the transition of the suffix too, which completes the table.
+	const auto states = m_next.size() / m_classes;
+	m_fail.assign(states, 0);
+	m_order.reserve(states);
+	m_order.push_back(0);
+	for (std::size_t idx = 0; idx < m_order.size(); ++idx) {
+		const auto state = m_order[idx];
+		for (std::size_t byte_class = 0; byte_class < m_classes; ++byte_class) {
+			auto& next = m_next[state * m_classes + byte_class];
+			const auto suffix_next = state == 0 ? 0 : m_next[m_fail[state] * m_classes + byte_class];
+			if (next == 0) {
+				next = suffix_next;
+			}
+			else {
+				m_fail[next] = suffix_next;
+				m_order.push_back(next);
+			}
+		}
+	}
+}
+
+void WordSearch::scan(StridedView<const char> line, std::vector<std::int64_t>& visits) const
+{
+	std::uint32_t state = 0;
+	for (const char c : line) {
+		state = m_next[state * m_classes + m_class[static_cast<unsigned char>(c)]];
+		++visits[state];
+	}
+}
+
+std::vector<std::int64_t> WordSearch::count(const Grid<char>& grid) const
+{
+	std::vector<std::int64_t> visits(m_fail.size(), 0);
+	const auto rows = grid.rows();
+	const auto cols = grid.cols();
+	for (std::size_t row = 0; row < rows; ++row) {
+		const StridedView<const char> line(grid.row(row).data(), 1, cols);
+		scan(line, visits);
+		scan(line.reversed(), visits);
+	}
+
+	// Columns, diagonals and anti-diagonals are read row by row, keeping the state of every line until its next
+	// cell, so the grid is walked in memory order. Rows are taken top down, then bottom up for the opposite
+	// directions.
+	const auto diagonals = rows + cols - 1;
+	for (const bool down : {true, false}) {
+		std::vector<std::uint32_t> column(cols, 0);
+		std::vector<std::uint32_t> diagonal(diagonals, 0);
+		std::vector<std::uint32_t> anti_diagonal(diagonals, 0);
+		for (std::size_t step = 0; step < rows; ++step) {
+			const auto row = down ? step : rows - 1 - step;
+			const auto cells = grid.row(row);
+			for (std::size_t col = 0; col < cols; ++col) {
+				const auto byte_class = m_class[static_cast<unsigned char>(cells[col])];
+				auto advance = [&](std::uint32_t& state) {
+					state = m_next[state * m_classes + byte_class];
+					++visits[state];
+				};
+				advance(column[col]);
+				advance(diagonal[col + rows - 1 - row]);
+				advance(anti_diagonal[col + row]);
+			}
+		}
+	}
+
+	// A visit of a state is also a visit of all its suffixes, longest states first
+	for (auto it = m_order.rbegin(); it != m_order.rend(); ++it) {
+		if (*it != 0) {
+			visits[m_fail[*it]] += visits[*it];
+		}
+	}
+	std::vector<std::int64_t> counts;
+	counts.reserve(m_word_end.size());
+	for (const auto state : m_word_end) {
+		counts.push_back(visits[state]);
+	}
+	return counts;
+}
+
+}  // namespace utils
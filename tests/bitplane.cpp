@@ -0,0 +1,29 @@
+#include "doctest.h"
+
+#include "bitplane.h"
+#include "grid.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+TEST_SUITE("BitPlane")
+{
+	TEST_CASE("Shifted reads")
+	{
+		// Two words per row, X in the first and last column and around the word border
+		std::string row(100, '.');
+		row[0] = row[63] = row[64] = row[99] = 'X';
+		const auto grid = utils::load_grid(std::string_view(row + '\n' + std::string(100, 'X') + '\n'));
+		const utils::BitPlane plane(grid, 'X');
+		CHECK(plane.rows() == 2);
+		CHECK(plane.words() == 2);
+		CHECK(plane.bits(0, 0, 0) == (1 | std::uint64_t{1} << 63));
+		CHECK(plane.bits(0, 1, 0) == (1 | std::uint64_t{1} << 35));
+		CHECK(plane.bits(0, 0, 1) == (std::uint64_t{3} << 62));
+		CHECK(plane.bits(0, 1, -1) == (std::uint64_t{3} | std::uint64_t{1} << 36));
+		// Columns before the first and after the last read as empty
+		CHECK(plane.bits(0, 0, -2) == std::uint64_t{1} << 2);
+		CHECK(plane.bits(1, 1, 3) == (std::uint64_t{1} << 33) - 1);
+	}
+}
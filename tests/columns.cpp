@@ -0,0 +1,57 @@
+#include "doctest.h"
+
+#include "columns.h"
+#include "scheduler.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <format>
+#include <string>
+#include <string_view>
+#include <vector>
+
+TEST_SUITE("Columns")
+{
+	TEST_CASE("Load")
+	{
+		const auto columns = utils::load_columns<std::int64_t, 3>(std::string_view("1 2 3\n\n-4   5 6\r\n7 8 9000000000"));
+		CHECK(columns.rows() == 3);
+		CHECK(columns[0] == std::vector<std::int64_t>{1, -4, 7});
+		CHECK(columns[2] == std::vector<std::int64_t>{3, 6, 9'000'000'000});
+
+		CHECK(utils::load_columns<int, 2>(std::string_view("")).rows() == 0);
+		CHECK_THROWS(utils::load_columns<int, 2>(std::string_view("1 2\n3\n")));
+		CHECK_THROWS(utils::load_columns<int, 2>(std::string_view("1 2 3 4\n")));
+		// Numbers never move between lines, even if the counts of neighbouring lines add up
+		CHECK_THROWS_WITH((utils::load_columns<int, 2>(std::string_view("1 2 3\n4\n"))),
+		                  "Line 1 does not have 2 numbers");
+		CHECK_THROWS_WITH((utils::load_columns<int, 2>(std::string_view("1 2\n\n3\n4 5 6\n"))),
+		                  "Line 3 does not have 2 numbers");
+	}
+
+	TEST_CASE("Parallel")
+	{
+		// Several pieces of the minimal size with empty lines which have to be removed from the result
+		std::string text;
+		int rows = 0;
+		while (text.size() < 5 * utils::parallel_parse_min_bytes) {
+			text += std::to_string(rows) + "   " + std::to_string(-rows) + (rows % 1000 == 0 ? "\n\n" : "\n");
+			++rows;
+		}
+		utils::Scheduler scheduler(4);
+		const auto columns = utils::load_columns<int, 2>(text, scheduler);
+		REQUIRE(columns.rows() == static_cast<std::size_t>(rows));
+		bool all_match = true;
+		for (int row = 0; row < rows; ++row) {
+			all_match = all_match && columns[0][row] == row && columns[1][row] == -row;
+		}
+		CHECK(all_match);
+		CHECK(columns[0] == utils::load_columns<int, 2>(std::string_view(text))[0]);
+
+		// Errors in later pieces name the line of the whole text
+		const auto lines = std::ranges::count(text, '\n');
+		text += "1 2 3\n4\n";
+		CHECK_THROWS_WITH((utils::load_columns<int, 2>(text, scheduler)),
+		                  std::format("Line {} does not have 2 numbers", lines + 1).c_str());
+	}
+}
@@ -0,0 +1,64 @@
+#include "doctest.h"
+
+#include "common.h"
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+TEST_SUITE("Utils")
+{
+	TEST_CASE("Lines")
+	{
+		auto split = [](std::string_view text) {
+			std::vector<std::string_view> ret;
+			for (const auto line : utils::lines(text)) {
+				ret.push_back(line);
+			}
+			return ret;
+		};
+		CHECK(split("").empty());
+		CHECK(split("a\nbc\n") == std::vector<std::string_view>{"a", "bc"});
+		CHECK(split("a\r\n\r\nbc") == std::vector<std::string_view>{"a", "", "bc"});
+	}
+
+	TEST_CASE("Line chunks")
+	{
+		auto split = [](std::string_view text, std::size_t chunks) {
+			std::vector<std::string_view> ret;
+			for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+				ret.push_back(utils::line_chunk(text, chunk, chunks));
+			}
+			return ret;
+		};
+		CHECK(split("ab\ncd\nef\n", 1) == std::vector<std::string_view>{"ab\ncd\nef\n"});
+		CHECK(split("ab\ncd\nef\n", 3) == std::vector<std::string_view>{"ab\n", "cd\n", "ef\n"});
+		CHECK(split("ab\ncd\nef", 2) == std::vector<std::string_view>{"ab\ncd\n", "ef"});
+		CHECK(split("abcdef\ng", 4) == std::vector<std::string_view>{"abcdef\n", "", "", "g"});
+		CHECK(split("", 2) == std::vector<std::string_view>{"", ""});
+	}
+
+	TEST_CASE("MappedFile")
+	{
+		const utils::MappedFile file(utils::abs_exe_directory() / "input" / "day1.small.txt");
+		CHECK(std::ranges::distance(file.lines()) == 6);
+		CHECK(*file.lines().begin() == "3   4");
+		CHECK_THROWS(utils::MappedFile(utils::abs_exe_directory() / "input" / "missing.txt"));
+	}
+
+	TEST_CASE("IntScanner")
+	{
+		CHECK(utils::to_int<int>("1234567") == 1'234'567);
+		CHECK(utils::to_int<std::int64_t>("286580387663654") == 286'580'387'663'654);
+		CHECK(utils::to_int<int>("-42") == -42);
+		CHECK_THROWS(utils::to_int<int>("12a"));
+		CHECK_THROWS(utils::to_int<std::int16_t>("40000"));
+
+		utils::IntScanner scanner("3267: 81 40 27\n12345678,9");
+		std::vector<std::int64_t> values;
+		for (std::int64_t value; scanner.next(value);) {
+			values.push_back(value);
+		}
+		CHECK(values == std::vector<std::int64_t>{3'267, 81, 40, 27, 12'345'678, 9});
+	}
+}
@@ -0,0 +1,82 @@
+#include "doctest.h"
+
+#include "common.h"
+#include "solvers.h"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <span>
+#include <string_view>
+#include <vector>
+
+TEST_SUITE("Day1")
+{
+	const auto small_input_file = utils::abs_exe_directory() / "input" / "day1.small.txt";
+	const auto full_input_file = utils::abs_exe_directory() / "input" / "day1.full.txt";
+
+	TEST_CASE("Part1")
+	{
+		CHECK(solve_day1(1, small_input_file) == 11);
+		CHECK(solve_day1(1, full_input_file) == 2'815'556);
+	}
+
+	TEST_CASE("Part2")
+	{
+		CHECK(solve_day1(2, small_input_file) == 31);
+		CHECK(solve_day1(2, full_input_file) == 23'927'637);
+	}
+
+	TEST_CASE("FromMemory")
+	{
+		const std::string_view text = "3   4\n4   3\n2   5\n1   3\n3   9\n3   3\n";
+		CHECK(solve_day1(1, text) == 11);
+		CHECK(solve_day1(2, utils::as_text(std::as_bytes(std::span(text)))) == 31);
+	}
+
+	TEST_CASE("Similarity")
+	{
+		std::mt19937 rng(2024);
+		auto brute_force = [](const Day1Input& input) {
+			int result = 0;
+			for (const auto val : input.col1) {
+				result += val * static_cast<int>(std::ranges::count(input.col2, val));
+			}
+			return result;
+		};
+		// Dense values, sparse values (hash table) and sorted columns (merge join)
+		for (const int spread : {100, 1'000'000'000}) {
+			std::uniform_int_distribution<int> dist(0, spread);
+			Day1Input input;
+			for (int i = 0; i < 2000; ++i) {
+				input.col1.push_back(dist(rng) % 50 == 0 ? 77 : dist(rng));
+				input.col2.push_back(dist(rng) % 50 == 0 ? 77 : dist(rng));
+			}
+			CHECK(solve_day1(2, input) == brute_force(input));
+			std::ranges::sort(input.col1);
+			std::ranges::sort(input.col2);
+			CHECK(solve_day1(2, input) == brute_force(input));
+		}
+	}
+
+	TEST_CASE("Large values")
+	{
+		constexpr int max = std::numeric_limits<int>::max();
+		constexpr int min = std::numeric_limits<int>::min();
+		CHECK(solve_day1(1, Day1Input{{min, 0}, {max, 0}}) == 4'294'967'295);
+		CHECK(solve_day1(2, Day1Input{{max, 5, max}, {max, max, 1}}) == 8'589'934'588);
+	}
+
+	TEST_CASE("Streaming")
+	{
+		// A small budget makes the columns to be read in many batches
+		for (const std::size_t budget : {std::size_t{1} << 20, std::size_t{4096}}) {
+			CHECK(solve_day1_streaming(1, small_input_file, budget) == 11);
+			CHECK(solve_day1_streaming(2, small_input_file, budget) == 31);
+			CHECK(solve_day1_streaming(1, full_input_file, budget) == 2'815'556);
+			CHECK(solve_day1_streaming(2, full_input_file, budget) == 23'927'637);
+		}
+		CHECK_THROWS(solve_day1_streaming(1, full_input_file, 100));
+		CHECK_THROWS(solve_day1_streaming(3, full_input_file, 4096));
+	}
+}
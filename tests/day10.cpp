@@ -0,0 +1,22 @@
+#include "doctest.h"
+
+#include "common.h"
+#include "solvers.h"
+
+TEST_SUITE("Day10")
+{
+	const auto small_input_file = utils::abs_exe_directory() / "input" / "day10.small.txt";
+	const auto full_input_file = utils::abs_exe_directory() / "input" / "day10.full.txt";
+
+	TEST_CASE("Part1")
+	{
+		CHECK(solve_day10(1, small_input_file) == 36);
+		CHECK(solve_day10(1, full_input_file) == 646);
+	}
+
+	TEST_CASE("Part2")
+	{
+		CHECK(solve_day10(2, small_input_file) == 81);
+		CHECK(solve_day10(2, full_input_file) == 1'494);
+	}
+}
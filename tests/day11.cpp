@@ -0,0 +1,22 @@
+#include "doctest.h"
+
+#include "common.h"
+#include "solvers.h"
+
+TEST_SUITE("Day11")
+{
+	const auto small_input_file = utils::abs_exe_directory() / "input" / "day11.small.txt";
+	const auto full_input_file = utils::abs_exe_directory() / "input" / "day11.full.txt";
+
+	TEST_CASE("Part1")
+	{
+		CHECK(solve_day11(25, small_input_file) == 55'312);
+		CHECK(solve_day11(25, full_input_file) == 197'157);
+	}
+
+	TEST_CASE("Part2")
+	{
+		CHECK(solve_day11(75, small_input_file) == 65'601'038'650'482);
+		CHECK(solve_day11(75, full_input_file) == 234'430'066'982'597);
+	}
+}
@@ -0,0 +1,102 @@
+#include "doctest.h"
+
+#include "common.h"
+#include "solvers.h"
+
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+TEST_SUITE("Day2")
+{
+	const auto small_input_file = utils::abs_exe_directory() / "input" / "day2.small.txt";
+	const auto full_input_file = utils::abs_exe_directory() / "input" / "day2.full.txt";
+
+	TEST_CASE("Part1")
+	{
+		CHECK(solve_day2(1, small_input_file) == 2);
+		CHECK(solve_day2(1, full_input_file) == 218);
+	}
+
+	TEST_CASE("Part2")
+	{
+		CHECK(solve_day2(2, small_input_file) == 4);
+		CHECK(solve_day2(2, full_input_file) == 290);
+	}
+
+	TEST_CASE("Dampener")
+	{
+		// Removing the first, the second, a middle or the last level
+		CHECK(solve_day2(2, std::string_view("9 1 2 3\n1 9 2 3\n1 2 9 3 4\n1 2 3 9\n1 2 3 2 1\n5\n")) == 5);
+
+		// Every removal tried on random rows
+		auto stable = [](const std::vector<int>& row) {
+			bool increasing = true;
+			bool decreasing = true;
+			for (std::size_t idx = 1; idx < row.size(); ++idx) {
+				const auto step = row[idx] - row[idx - 1];
+				increasing = increasing && step >= 1 && step <= 3;
+				decreasing = decreasing && step <= -1 && step >= -3;
+			}
+			return increasing || decreasing;
+		};
+		std::mt19937 rng(2);
+		std::uniform_int_distribution<int> step(-4, 4);
+		std::string text;
+		int expected = 0;
+		for (int i = 0; i < 2000; ++i) {
+			std::vector<int> row{50};
+			const int sign = i % 2 == 0 ? 1 : -1;
+			while (row.size() < 3u + i % 6) {
+				// Mostly steps in one direction, sometimes a wrong one
+				const int delta = rng() % 4 == 0 ? step(rng) : sign * (1 + static_cast<int>(rng() % 3));
+				row.push_back(row.back() + delta);
+			}
+			bool safe = stable(row);
+			for (std::size_t idx = 0; idx < row.size() && !safe; ++idx) {
+				auto shorter = row;
+				shorter.erase(shorter.begin() + static_cast<std::ptrdiff_t>(idx));
+				safe = stable(shorter);
+			}
+			expected += safe ? 1 : 0;
+			for (const auto level : row) {
+				text += std::to_string(level) + ' ';
+			}
+			text += '\n';
+		}
+		CHECK(solve_day2(2, std::string_view(text)) == expected);
+	}
+
+	TEST_CASE("Empty lines")
+	{
+		// Blank lines between and after the reports of the example are skipped
+		const std::string_view text = "7 6 4 2 1\n1 2 7 8 9\n\n9 7 6 2 1\n1 3 2 4 5\n\r\n8 6 4 4 1\n1 3 6 7 9\n\n\n";
+		CHECK(solve_day2(1, text) == 2);
+		CHECK(solve_day2(2, text) == 4);
+		const auto rows = parse_day2(text);
+		CHECK(rows.rows() == 6);
+		CHECK(solve_day2(1, rows) == 2);
+		CHECK(solve_day2(2, rows) == 4);
+	}
+
+	TEST_CASE("Chunked text")
+	{
+		// Large enough to be split into several pieces, the parsed rows give the same answers
+		std::mt19937 rng(3);
+		std::string text;
+		while (text.size() < 3 * utils::parallel_parse_min_bytes) {
+			int level = 50;
+			for (int i = 0; i < 5 + static_cast<int>(rng() % 4); ++i) {
+				level += static_cast<int>(rng() % 5) - 1;
+				text += std::to_string(level) + ' ';
+			}
+			text += '\n';
+		}
+		const auto rows = parse_day2(text);
+		CHECK(solve_day2(1, std::string_view(text)) == solve_day2(1, rows));
+		CHECK(solve_day2(2, std::string_view(text)) == solve_day2(2, rows));
+		CHECK(solve_day2(1, std::string_view(text)) > 0);
+		CHECK_THROWS(solve_day2(3, std::string_view(text)));
+	}
+}
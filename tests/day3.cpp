@@ -0,0 +1,87 @@
+#include "doctest.h"
+
+#include "common.h"
+#include "solvers.h"
+
+#include <string>
+#include <string_view>
+
+TEST_SUITE("Day3")
+{
+	const auto small_input_file = utils::abs_exe_directory() / "input" / "day3.small.txt";
+	const auto full_input_file = utils::abs_exe_directory() / "input" / "day3.full.txt";
+
+	TEST_CASE("Part1")
+	{
+		CHECK(solve_day3(1, small_input_file) == 161);
+		CHECK(solve_day3(1, full_input_file) == 170'807'108);
+	}
+
+	TEST_CASE("Part2")
+	{
+		CHECK(solve_day3(2, small_input_file) == 48);
+		CHECK(solve_day3(2, full_input_file) == 74'838'033);
+	}
+
+	TEST_CASE("FromMemory")
+	{
+		const std::string_view memory = "xmul(2,4)&mul[3,7]!^don't()_mul(5,5)+mul(32,64](mul(11,8)undo()?mul(8,5))";
+		CHECK(solve_day3(1, memory) == 161);
+		CHECK(solve_day3(2, memory) == 48);
+	}
+
+	TEST_CASE("Instructions")
+	{
+		// Numbers have 1 to 3 digits, nothing may be between the parts
+		CHECK(solve_day3(1, std::string_view("mul(1234,5)mul(1,2345)mul(,5)mul(5,)mul( 1,2)mul(999,999)")) == 998'001);
+		CHECK(solve_day3(1, std::string_view("mmul(2,3)mul(2,3")) == 6);
+		CHECK(solve_day3(2, std::string_view("don't()mul(2,3)do(mul(1,1)do()mul(4,4)dont()mul(1,2)")) == 18);
+		CHECK_THROWS(solve_day3(3, std::string_view("")));
+
+		// Instructions crossing the 64 byte blocks of the scanner
+		for (std::size_t offset = 50; offset < 70; ++offset) {
+			const auto memory = std::string(offset, 'x') + "don't()mul(11,8)do()mul(12,10)";
+			CHECK(solve_day3(1, std::string_view(memory)) == 208);
+			CHECK(solve_day3(2, std::string_view(memory)) == 120);
+		}
+	}
+
+	TEST_CASE("Pieces")
+	{
+		// Long enough to be scanned in several pieces, with instructions cut by the piece borders
+		std::string memory;
+		std::int64_t all = 0;
+		std::int64_t enabled = 0;
+		for (int i = 0; memory.size() < 1'500'000; ++i) {
+			memory += "don't()mul(2,3)do()mul(4,4)?";
+			all += 22;
+			enabled += 16;
+		}
+		CHECK(solve_day3(1, std::string_view(memory)) == all);
+		CHECK(solve_day3(2, std::string_view(memory)) == enabled);
+
+		// Pieces without any switch take the state of the pieces before them
+		std::string repeated;
+		while (repeated.size() < 1'000'000) {
+			repeated += "mul(1,1)";
+		}
+		const auto count = static_cast<std::int64_t>(repeated.size() / 8);
+		CHECK(solve_day3(2, std::string_view("don't()" + repeated + "do()mul(5,5)")) == 25);
+		CHECK(solve_day3(2, std::string_view("do()" + repeated + "don't()mul(5,5)")) == count);
+		CHECK(solve_day3(1, std::string_view("don't()" + repeated + "do()mul(5,5)")) == count + 25);
+	}
+
+	TEST_CASE("Grammar")
+	{
+		// The grammar engine finds the same instructions as the hand written matchers
+		for (const std::string_view memory :
+		     {std::string_view("xmul(2,4)&mul[3,7]!^don't()_mul(5,5)+mul(32,64](mul(11,8)undo()?mul(8,5))"),
+		      std::string_view("mul(1234,5)mul(1,2345)mul(,5)mul(5,)mul( 1,2)mul(999,999)mmul(2,3)mul(2,3"),
+		      std::string_view("don't()mul(2,3)do(mul(1,1)do()mul(4,4)dont()mul(1,2)")}) {
+			for (const int part : {1, 2}) {
+				CHECK(solve_day3_grammar(part, memory) == solve_day3(part, memory));
+			}
+		}
+		CHECK(solve_day3_grammar(2, utils::MappedFile(full_input_file).view()) == 74'838'033);
+	}
+}
@@ -0,0 +1,97 @@
+#include "doctest.h"
+
+#include "common.h"
+#include "solvers.h"
+#include "word_search.h"
+
+#include <array>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+
+TEST_SUITE("Day4")
+{
+	const auto small_input_file = utils::abs_exe_directory() / "input" / "day4.small.txt";
+	const auto full_input_file = utils::abs_exe_directory() / "input" / "day4.full.txt";
+
+	TEST_CASE("Part1")
+	{
+		CHECK(solve_day4(1, small_input_file) == 18);
+		CHECK(solve_day4(1, full_input_file) == 2'593);
+	}
+
+	TEST_CASE("Part2")
+	{
+		CHECK(solve_day4(2, small_input_file) == 9);
+		CHECK(solve_day4(2, full_input_file) == 1'950);
+	}
+
+	TEST_CASE("Wide grids")
+	{
+		// Random grids wider than one plane word against a cell by cell search
+		std::mt19937 rng(4);
+		for (const auto& [rows, cols] : {std::pair{1, 4}, std::pair{3, 3}, std::pair{7, 64}, std::pair{40, 131}}) {
+			std::string text;
+			for (int row = 0; row < rows; ++row) {
+				for (int col = 0; col < cols; ++col) {
+					text += "XMAS"[rng() % 4];
+				}
+				text += '\n';
+			}
+			const auto grid = parse_day4(text);
+			auto at = [&](int row, int col) { return grid.in_bounds(row, col) ? grid(row, col) : '.'; };
+			int xmas = 0;
+			int crosses = 0;
+			for (int row = 0; row < rows; ++row) {
+				for (int col = 0; col < cols; ++col) {
+					for (int drow = -1; drow <= 1; ++drow) {
+						for (int dcol = -1; dcol <= 1; ++dcol) {
+							std::string word;
+							for (int idx = 0; idx < 4; ++idx) {
+								word += at(row + idx * drow, col + idx * dcol);
+							}
+							xmas += word == "XMAS" ? 1 : 0;
+						}
+					}
+					const std::string diagonal{at(row - 1, col - 1), at(row, col), at(row + 1, col + 1)};
+					const std::string anti_diagonal{at(row - 1, col + 1), at(row, col), at(row + 1, col - 1)};
+					auto is_mas = [](const std::string& line) { return line == "MAS" || line == "SAM"; };
+					crosses += is_mas(diagonal) && is_mas(anti_diagonal) ? 1 : 0;
+				}
+			}
+			CAPTURE(cols);
+			CHECK(solve_day4(1, grid) == xmas);
+			CHECK(solve_day4(2, grid) == crosses);
+		}
+	}
+
+	TEST_CASE("Bands")
+	{
+		// Tall enough to be counted in several bands, the words are counted by the word search as well
+		std::mt19937 rng(5);
+		std::string text;
+		for (int row = 0; row < 2000; ++row) {
+			for (int col = 0; col < 500; ++col) {
+				text += "XMAS"[rng() % 4];
+			}
+			text += '\n';
+		}
+		const auto grid = parse_day4(text);
+		const std::array words{std::string_view("XMAS")};
+		CHECK(solve_day4(1, grid) == utils::WordSearch(words).count(grid)[0]);
+
+		int crosses = 0;
+		for (std::size_t row = 1; row + 1 < grid.rows(); ++row) {
+			for (std::size_t col = 1; col + 1 < grid.cols(); ++col) {
+				auto is_mas = [&](int dcol) {
+					const auto first = grid(static_cast<std::ptrdiff_t>(row) - 1, static_cast<std::ptrdiff_t>(col) - dcol);
+					const auto last = grid(static_cast<std::ptrdiff_t>(row) + 1, static_cast<std::ptrdiff_t>(col) + dcol);
+					return (first == 'M' && last == 'S') || (first == 'S' && last == 'M');
+				};
+				crosses += grid(row, col) == 'A' && is_mas(1) && is_mas(-1) ? 1 : 0;
+			}
+		}
+		CHECK(solve_day4(2, grid) == crosses);
+	}
+}
@@ -0,0 +1,22 @@
+#include "doctest.h"
+
+#include "common.h"
+#include "solvers.h"
+
+TEST_SUITE("Day5")
+{
+	const auto small_input_file = utils::abs_exe_directory() / "input" / "day5.small.txt";
+	const auto full_input_file = utils::abs_exe_directory() / "input" / "day5.full.txt";
+
+	TEST_CASE("Part1")
+	{
+		CHECK(solve_day5(1, small_input_file) == 143);
+		CHECK(solve_day5(1, full_input_file) == 4'637);
+	}
+
+	TEST_CASE("Part2")
+	{
+		CHECK(solve_day5(2, small_input_file) == 123);
+		CHECK(solve_day5(2, full_input_file) == 6'370);
+	}
+}
@@ -0,0 +1,22 @@
+#include "doctest.h"
+
+#include "common.h"
+#include "solvers.h"
+
+TEST_SUITE("Day6")
+{
+	const auto small_input_file = utils::abs_exe_directory() / "input" / "day6.small.txt";
+	const auto full_input_file = utils::abs_exe_directory() / "input" / "day6.full.txt";
+
+	TEST_CASE("Part1")
+	{
+		CHECK(solve_day6(1, small_input_file) == 41);
+		CHECK(solve_day6(1, full_input_file) == 4'967);
+	}
+
+	TEST_CASE("Part2")
+	{
+		CHECK(solve_day6(2, small_input_file) == 6);
+		CHECK(solve_day6(2, full_input_file) == 1'789);
+	}
+}
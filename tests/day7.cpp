@@ -0,0 +1,23 @@
+#include "doctest.h"
+
+#include "common.h"
+#include "solvers.h"
+
+TEST_SUITE("Day7")
+{
+	const auto small_input_file = utils::abs_exe_directory() / "input" / "day7.small.txt";
+	const auto full_input_file = utils::abs_exe_directory() / "input" / "day7.full.txt";
+
+	TEST_CASE("Part1")
+	{
+		CHECK(solve_day7(1, small_input_file) == 3'749);
+		CHECK(solve_day7(1, full_input_file) == 14'711'933'466'277);
+	}
+
+	TEST_CASE("Part2")
+	{
+		CHECK(solve_day7(2, small_input_file) == 11'387);
+		// Extremely inefective. Do not run unless you really need it
+		//CHECK(solve_day7(2, full_input_file) == 286'580'387'663'654);
+	}
+}
@@ -0,0 +1,22 @@
+#include "doctest.h"
+
+#include "common.h"
+#include "solvers.h"
+
+TEST_SUITE("Day8")
+{
+	const auto small_input_file = utils::abs_exe_directory() / "input" / "day8.small.txt";
+	const auto full_input_file = utils::abs_exe_directory() / "input" / "day8.full.txt";
+
+	TEST_CASE("Part1")
+	{
+		CHECK(solve_day8(1, small_input_file) == 14);
+		CHECK(solve_day8(1, full_input_file) == 303);
+	}
+
+	TEST_CASE("Part2")
+	{
+		CHECK(solve_day8(2, small_input_file) == 34);
+		CHECK(solve_day8(2, full_input_file) == 1'045);
+	}
+}
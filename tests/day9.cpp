@@ -0,0 +1,23 @@
+#include "doctest.h"
+
+#include "common.h"
+#include "solvers.h"
+
+TEST_SUITE("Day9")
+{
+	const auto small_input_file = utils::abs_exe_directory() / "input" / "day9.small.txt";
+	const auto full_input_file = utils::abs_exe_directory() / "input" / "day9.full.txt";
+
+	// Part one is failing for GCC - TODO: find out why
+	TEST_CASE("Part1")
+	{
+		CHECK(solve_day9(1, small_input_file) == 1'928);
+		CHECK(solve_day9(1, full_input_file) == 6'370'402'949'053);
+	}
+
+	TEST_CASE("Part2")
+	{
+		CHECK(solve_day9(2, small_input_file) == 2'858);
+		CHECK(solve_day9(2, full_input_file) == 6'398'096'697'992);
+	}
+}
@@ -0,0 +1,62 @@
+#include "doctest.h"
+
+#include "grammar.h"
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+using utils::grammar::Int;
+using utils::grammar::Lit;
+using utils::grammar::Pattern;
+
+TEST_SUITE("Grammar")
+{
+	using Mul = Pattern<Lit<"mul(">, Int<1, 3>, Lit<",">, Int<1, 3>, Lit<")">>;
+	using Dont = Pattern<Lit<"don't()">>;
+
+	// The tables are built and can be run at compile time
+	static_assert(Mul::captures == 2 && Dont::captures == 0);
+	static_assert(Mul::first_char == 'm');
+	static_assert(Mul::match("mul(12,345)")->values == std::array<std::int64_t, 2>{12, 345});
+
+	TEST_CASE("Literals")
+	{
+		CHECK(Dont::match("don't()x")->length == 7);
+		CHECK_FALSE(Dont::match("don't(").has_value());
+		CHECK_FALSE(Dont::match("do()").has_value());
+		CHECK_FALSE(Dont::match("").has_value());
+
+		// Short texts, long texts and literals longer than a word
+		CHECK(utils::grammar::starts_with_literal("do()", "do()"));
+		CHECK(utils::grammar::starts_with_literal("don't()mul(1,2)", "don't()"));
+		CHECK_FALSE(utils::grammar::starts_with_literal("don't()mul(1,2)", "do()"));
+		CHECK_FALSE(utils::grammar::starts_with_literal("do(", "do()"));
+		CHECK(utils::grammar::starts_with_literal("abcdefghijkl", "abcdefghij"));
+		CHECK_FALSE(utils::grammar::starts_with_literal("abcdefghXjkl", "abcdefghij"));
+	}
+
+	TEST_CASE("Numbers")
+	{
+		const auto match = Mul::match("mul(7,999)mul(1,2)");
+		REQUIRE(match.has_value());
+		CHECK(match->length == 10);
+		CHECK(match->values[0] == 7);
+		CHECK(match->values[1] == 999);
+		for (const std::string_view text : {"mul(,1)", "mul(1,)", "mul(1234,1)", "mul(1,1234)", "mul(1 ,1)", "mul(1,1]",
+		                                    "mul(-1,1)", "mux(1,1)", "mul(1,1"}) {
+			CAPTURE(text);
+			CHECK_FALSE(Mul::match(text).has_value());
+		}
+	}
+
+	TEST_CASE("Digit ranges")
+	{
+		using Time = Pattern<Lit<"t=">, Int<2, 2>, Lit<":">, Int<2, 4>, Lit<";">>;
+		CHECK(Time::match("t=09:0042;")->values == std::array<std::int64_t, 2>{9, 42});
+		CHECK(Time::match("t=23:59;")->values == std::array<std::int64_t, 2>{23, 59});
+		CHECK_FALSE(Time::match("t=9:00;").has_value());
+		CHECK_FALSE(Time::match("t=09:0;").has_value());
+		CHECK_FALSE(Time::match("t=09:00000;").has_value());
+	}
+}
@@ -0,0 +1,38 @@
+#include "doctest.h"
+
+#include "grid.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std::string_view_literals;
+
+TEST_SUITE("Grid")
+{
+	TEST_CASE("Views")
+	{
+		const auto grid = utils::load_grid("abc\r\ndef\r\nghi\r\njkl\r\n"sv, 1, '#');
+		CHECK(grid.rows() == 4);
+		CHECK(grid.cols() == 3);
+		CHECK(grid.stride() == 5);
+		CHECK(grid(0, -1) == '#');
+		CHECK(grid(4, 2) == '#');
+		CHECK(grid(3, 1) == 'k');
+		CHECK(std::string(grid.row(1).begin(), grid.row(1).end()) == "def");
+		CHECK(std::ranges::equal(grid.column(1), std::string("behk")));
+		CHECK(std::ranges::equal(grid.diagonal(1, 0), std::string("dhl")));
+		CHECK(std::ranges::equal(grid.anti_diagonal(0, 2), std::string("ceg")));
+		CHECK(std::ranges::equal(grid.anti_diagonal(0, 2).reversed(), std::string("gec")));
+		CHECK(grid.column(0).reversed().size() == 4);
+		CHECK(grid.find('h') == std::make_pair(std::ptrdiff_t{2}, std::ptrdiff_t{1}));
+		CHECK(grid.position(grid.index(2, 1)) == std::make_pair(std::ptrdiff_t{2}, std::ptrdiff_t{1}));
+	}
+
+	TEST_CASE("Conversion")
+	{
+		const auto grid = utils::load_grid<int>("01\n23\n"sv, 0, 0, [](char c) { return c - '0'; });
+		CHECK(std::ranges::equal(grid.cells(), std::vector<int>{0, 1, 2, 3}));
+		CHECK_THROWS(utils::load_grid("abc\nde\n"sv));
+	}
+}
@@ -0,0 +1,42 @@
+#include "doctest.h"
+
+#include "jagged_array.h"
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+TEST_SUITE("JaggedArray")
+{
+	TEST_CASE("Rows")
+	{
+		const auto rows = utils::load_jagged_rows<std::int64_t>(std::string_view("1 2 3\n\n-4 5\r\n60000000000"));
+		REQUIRE(rows.rows() == 4);
+		CHECK(rows[1].empty());
+		CHECK(std::vector<std::int64_t>(rows[2].begin(), rows[2].end()) == std::vector<std::int64_t>{-4, 5});
+		CHECK(rows[3][0] == 60'000'000'000);
+		CHECK(rows.values().size() == 6);
+		const std::vector<std::size_t> offsets(rows.offsets().begin(), rows.offsets().end());
+		CHECK(offsets == std::vector<std::size_t>{0, 3, 3, 5, 6});
+
+		std::size_t total = 0;
+		for (const auto row : rows) {
+			total += row.size();
+		}
+		CHECK(total == 6);
+	}
+
+	TEST_CASE("Build")
+	{
+		utils::JaggedArray<int> rows;
+		CHECK(rows.empty());
+		rows.push_value(7);
+		rows.end_row();
+		rows.end_row();
+		CHECK(rows.rows() == 2);
+		rows[0][0] = 8;
+		CHECK(rows[0][0] == 8);
+		CHECK(rows[1].empty());
+		CHECK(utils::load_jagged_rows<int>(std::string_view("8\n\n")) == rows);
+	}
+}
@@ -0,0 +1,44 @@
+#include "doctest.h"
+
+#include "radix_sort.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <vector>
+
+TEST_SUITE("RadixSort")
+{
+	TEST_CASE_TEMPLATE("Random keys", T, std::int32_t, std::uint32_t, std::int64_t, std::uint64_t)
+	{
+		std::mt19937_64 rng(7);
+		std::uniform_int_distribution<T> full(std::numeric_limits<T>::min(), std::numeric_limits<T>::max());
+		std::uniform_int_distribution<T> narrow(0, 99'999);
+		std::vector<T> scratch;
+		for (auto* dist : {&full, &narrow}) {
+			std::vector<T> keys(5000);
+			std::ranges::generate(keys, [&] { return (*dist)(rng); });
+			keys.push_back(std::numeric_limits<T>::min());
+			keys.push_back(std::numeric_limits<T>::max());
+			auto expected = keys;
+			std::ranges::sort(expected);
+			utils::radix_sort(std::span(keys), scratch);
+			CHECK(keys == expected);
+		}
+	}
+
+	TEST_CASE("Small inputs")
+	{
+		std::vector<int> keys;
+		utils::radix_sort(std::span(keys));
+		CHECK(keys.empty());
+		keys = {-3};
+		utils::radix_sort(std::span(keys));
+		CHECK(keys == std::vector<int>{-3});
+		keys = {5, -1, 5, 0, -7};
+		utils::radix_sort(std::span(keys));
+		CHECK(keys == std::vector<int>{-7, -1, 0, 5, 5});
+	}
+}
@@ -0,0 +1,33 @@
+#include "doctest.h"
+
+#include "common.h"
+#include "registry.h"
+
+#include <format>
+
+TEST_SUITE("Registry")
+{
+	TEST_CASE("Expected answers")
+	{
+		const auto input_dir = utils::abs_exe_directory() / "input";
+		for_each_solver([&](const auto& solver) {
+			INFO(std::format("day {} part {}", solver.day, solver.part));
+			if (solver.expected.small) {
+				const utils::MappedFile file(input_dir / std::format("day{}.small.txt", solver.day));
+				CHECK(solver.run(file.view()) == *solver.expected.small);
+			}
+			if (solver.expected.full && !solver.slow) {
+				const utils::MappedFile file(input_dir / std::format("day{}.full.txt", solver.day));
+				CHECK(solver.run(file.view()) == *solver.expected.full);
+			}
+		});
+	}
+
+	TEST_CASE("Dispatch")
+	{
+		CHECK(solver_count == 22);
+		CHECK(run_solver(3, 1, "mul(2,3)do()mul(4,5)") == 26);
+		CHECK_THROWS(run_solver(12, 1, ""));
+		CHECK_THROWS(run_solver(1, 3, ""));
+	}
+}
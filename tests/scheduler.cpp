@@ -0,0 +1,80 @@
+#include "doctest.h"
+
+#include "scheduler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_SUITE("Scheduler")
+{
+	TEST_CASE("ParallelFor")
+	{
+		utils::Scheduler scheduler(4);
+		CHECK(scheduler.size() == 4);
+
+		std::vector<int> hits(10'000, 0);
+		scheduler.parallel_for(0, hits.size(), 7, [&](std::size_t idx) { ++hits[idx]; });
+		CHECK(std::ranges::all_of(hits, [](int val) { return val == 1; }));
+
+		// Empty range and nested loops
+		scheduler.parallel_for(5, 5, 1, [](std::size_t) { throw std::logic_error("not called"); });
+		std::atomic<int> nested{0};
+		scheduler.parallel_for(0, 10, 1, [&](std::size_t) {
+			scheduler.parallel_for(0, 10, 1, [&](std::size_t) { ++nested; });
+		});
+		CHECK(nested == 100);
+
+		CHECK_THROWS_AS(scheduler.parallel_for(0, 100, 1,
+		                                       [](std::size_t idx) {
+			                                       if (idx == 42) {
+				                                       throw std::runtime_error("failed");
+			                                       }
+		                                       }),
+		                std::runtime_error);
+	}
+
+	TEST_CASE("OutsideCallers")
+	{
+		// Loops started by several threads outside of the scheduler at the same time
+		utils::Scheduler scheduler(3);
+		std::vector<std::int64_t> sums(4, 0);
+		{
+			std::vector<std::jthread> callers;
+			for (std::size_t caller = 0; caller < sums.size(); ++caller) {
+				callers.emplace_back([&, caller] {
+					for (int repeat = 0; repeat < 50; ++repeat) {
+						sums[caller] += scheduler.parallel_reduce(
+						    0, 1000, 10, std::int64_t{0}, [](std::size_t idx) { return static_cast<std::int64_t>(idx); },
+						    std::plus<>{});
+					}
+				});
+			}
+		}
+		CHECK(std::ranges::all_of(sums, [](std::int64_t sum) { return sum == 50 * 499'500; }));
+
+		CHECK(&utils::default_scheduler() == &utils::default_scheduler());
+	}
+
+	TEST_CASE("ParallelReduce")
+	{
+		utils::Scheduler scheduler(3);
+		const auto sum = scheduler.parallel_reduce(1, 100'001, 100, std::int64_t{0},
+		                                           [](std::size_t idx) { return static_cast<std::int64_t>(idx); },
+		                                           std::plus<>{});
+		CHECK(sum == 5'000'050'000);
+
+		// The order of the indices is kept for non commutative operations
+		const auto text = scheduler.parallel_reduce(0, 26, 3, std::string{},
+		                                            [](std::size_t idx) { return std::string(1, char('a' + idx)); },
+		                                            std::plus<>{});
+		CHECK(text == "abcdefghijklmnopqrstuvwxyz");
+
+		CHECK(utils::parallel_reduce(0, 0, 1, 7, [](std::size_t) { return 1; }, std::plus<>{}) == 7);
+	}
+}
@@ -0,0 +1,102 @@
+#include "doctest.h"
+
+#include "simd.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+TEST_SUITE("Simd")
+{
+	TEST_CASE("Kernels")
+	{
+		INFO("AVX2: ", utils::has_avx2());
+		std::mt19937 rng(11);
+		// Products of values up to 2^24 cannot overflow the 64 bit sum
+		std::uniform_int_distribution<int> dist(-(1 << 24), 1 << 24);
+		// Lengths around the vector width exercise the tail loop
+		for (std::size_t size = 0; size < 40; ++size) {
+			std::vector<int> a(size);
+			std::vector<int> b(size);
+			std::ranges::generate(a, [&] { return dist(rng); });
+			std::ranges::generate(b, [&] { return dist(rng); });
+			std::int64_t abs_diff = 0;
+			std::int64_t dot = 0;
+			for (std::size_t idx = 0; idx < size; ++idx) {
+				abs_diff += std::max(a[idx], b[idx]) - static_cast<std::int64_t>(std::min(a[idx], b[idx]));
+				dot += static_cast<std::int64_t>(a[idx]) * b[idx];
+			}
+			CHECK(utils::sum_abs_diff(a, b) == abs_diff);
+			CHECK(utils::dot_product(a, b) == dot);
+		}
+	}
+
+	TEST_CASE("Extremes")
+	{
+		constexpr std::int64_t max = std::numeric_limits<int>::max();
+		constexpr std::int64_t min = std::numeric_limits<int>::min();
+		const std::vector<int> a(19, static_cast<int>(min));
+		const std::vector<int> b(19, static_cast<int>(max));
+		CHECK(utils::sum_abs_diff(a, b) == 19 * (max - min));
+		CHECK(utils::dot_product(a, std::vector<int>(19, -1)) == -19 * min);
+		CHECK(utils::dot_product(std::vector<int>{a[0], b[0]}, std::vector<int>{a[0], b[0]}) == min * min + max * max);
+	}
+
+	TEST_CASE("Steps in band")
+	{
+		auto expected = [](std::span<const int> row) {
+			bool increasing = true;
+			bool decreasing = true;
+			for (std::size_t idx = 1; idx < row.size(); ++idx) {
+				const auto step = row[idx] - row[idx - 1];
+				increasing = increasing && step >= 1 && step <= 3;
+				decreasing = decreasing && step >= -3 && step <= -1;
+			}
+			return increasing || decreasing;
+		};
+		std::mt19937 rng(5);
+		std::vector<int> values;
+		std::vector<std::size_t> offsets{0};
+		std::size_t stable_rows = 0;
+		std::size_t mismatches = 0;
+		for (int i = 0; i < 3000; ++i) {
+			// Mostly short rows, some longer than the vector width and a few longer than the kernel window
+			const std::size_t size = i % 500 == 0 ? 5000 : i % 10 == 0 ? rng() % 40 : rng() % 9;
+			const int sign = i % 2 == 0 ? 1 : -1;
+			std::vector<int> row;
+			for (std::size_t idx = 0; idx < size; ++idx) {
+				const int step =
+				    rng() % 50 == 0 ? static_cast<int>(rng() % 9) - 4 : sign * (1 + static_cast<int>(rng() % 3));
+				row.push_back(row.empty() ? 100 : row.back() + step);
+			}
+			const bool stable = expected(row);
+			mismatches += utils::steps_in_band(row, 1, 3) != stable ? 1 : 0;
+			stable_rows += stable ? 1 : 0;
+			values.insert(values.end(), row.begin(), row.end());
+			offsets.push_back(values.size());
+		}
+		CHECK(mismatches == 0);
+		CHECK(utils::count_steps_in_band(values, offsets, 1, 3) == stable_rows);
+		CHECK(utils::count_steps_in_band(values, std::span(offsets).first(1), 1, 3) == 0);
+	}
+
+	TEST_CASE("Byte mask")
+	{
+		std::string text(100, '.');
+		text[0] = 'm';
+		text[31] = 'd';
+		text[32] = 'm';
+		text[63] = 'd';
+		text[64] = 'm';
+		const std::uint64_t expected = 1 | std::uint64_t{3} << 31 | std::uint64_t{1} << 63;
+		CHECK(utils::byte_mask(text, 'm', 'd') == expected);
+		CHECK(utils::byte_mask(std::string_view(text).substr(31), 'm', 'd') == (std::uint64_t{3} << 32 | 3));
+		CHECK(utils::byte_mask(std::string_view(text).substr(0, 33), 'd', 'd') == std::uint64_t{1} << 31);
+		CHECK(utils::byte_mask("", 'm', 'd') == 0);
+	}
+}
@@ -0,0 +1,34 @@
+#include "doctest.h"
+
+#include "thread_pool.h"
+
+#include <future>
+#include <stdexcept>
+#include <vector>
+
+TEST_SUITE("ThreadPool")
+{
+	TEST_CASE("Results")
+	{
+		utils::ThreadPool pool(3);
+		CHECK(pool.size() == 3);
+		CHECK(pool.worker_index() == 3);
+
+		std::vector<std::future<int>> results;
+		for (int i = 0; i < 100; ++i) {
+			results.push_back(pool.submit([i] { return i * i; }));
+		}
+		for (int i = 0; i < 100; ++i) {
+			CHECK(results[i].get() == i * i);
+		}
+		CHECK(pool.submit([&pool] { return pool.worker_index(); }).get() < 3);
+	}
+
+	TEST_CASE("Exceptions")
+	{
+		utils::ThreadPool pool(2);
+		auto failed = pool.submit([]() -> int { throw std::runtime_error("failed"); });
+		CHECK_THROWS_AS(failed.get(), std::runtime_error);
+		CHECK(pool.submit([] { return 1; }).get() == 1);
+	}
+}
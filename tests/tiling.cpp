@@ -0,0 +1,43 @@
+#include "doctest.h"
+
+#include "tiling.h"
+
+#include <cstddef>
+#include <vector>
+
+TEST_SUITE("Tiling")
+{
+	TEST_CASE("Bands")
+	{
+		auto collect = [](const utils::RowBand& band) { return std::vector{band}; };
+		auto append = [](std::vector<utils::RowBand> all, const std::vector<utils::RowBand>& more) {
+			all.insert(all.end(), more.begin(), more.end());
+			return all;
+		};
+		// Every row is owned by one band, the halos are clamped to the grid
+		for (const std::size_t cols : {std::size_t{1}, std::size_t{1000}, utils::band_min_cells}) {
+			const std::size_t rows = 1000;
+			const auto bands = utils::parallel_bands(rows, cols, 3, std::vector<utils::RowBand>{}, collect, append);
+			CAPTURE(cols);
+			REQUIRE(!bands.empty());
+			CHECK(bands.front().first == 0);
+			CHECK(bands.back().last == rows);
+			for (std::size_t idx = 0; idx < bands.size(); ++idx) {
+				const auto& band = bands[idx];
+				CHECK(band.first < band.last);
+				CHECK(band.halo_first == (band.first < 3 ? 0 : band.first - 3));
+				CHECK(band.halo_last == std::min(band.last + 3, rows));
+				if (idx > 0) {
+					CHECK(band.first == bands[idx - 1].last);
+				}
+			}
+		}
+		CHECK(utils::parallel_bands(0, 10, 3, std::vector<utils::RowBand>{}, collect, append).empty());
+
+		const utils::Grid<char> grid(2000, 500, '.');
+		const auto rows = utils::parallel_bands(grid, 3, std::size_t{0},
+		                                        [](const utils::RowBand& band) { return band.last - band.first; },
+		                                        [](std::size_t lhs, std::size_t rhs) { return lhs + rhs; });
+		CHECK(rows == grid.rows());
+	}
+}
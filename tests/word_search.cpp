@@ -0,0 +1,45 @@
+#include "doctest.h"
+
+#include "grid.h"
+#include "solvers.h"
+#include "word_search.h"
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std::string_view_literals;
+
+TEST_SUITE("WordSearch")
+{
+	TEST_CASE("Directions")
+	{
+		const auto grid = utils::load_grid("ABC\nDEF\nGHI\n"sv);
+		const std::array words{"AB"sv, "BA"sv, "AEI"sv, "IEA"sv, "CEG"sv, "GEC"sv, "ADG"sv, "ABCD"sv, "E"sv, "Z"sv};
+		const utils::WordSearch search(words);
+		CHECK(search.count(grid) == std::vector<std::int64_t>{1, 1, 1, 1, 1, 1, 1, 0, 8, 0});
+		CHECK_THROWS(utils::WordSearch(std::array{"A"sv, ""sv}));
+	}
+
+	TEST_CASE("Overlapping words")
+	{
+		// Words which are suffixes or prefixes of each other, repeated words and a palindrome
+		const auto grid = utils::load_grid("AAAA\n"sv);
+		const std::array words{"A"sv, "AA"sv, "AAA"sv, "AA"sv};
+		const utils::WordSearch search(words);
+		// A single row: A 4 times in 8 directions, longer words forwards and backwards along the row only
+		CHECK(search.count(grid) == std::vector<std::int64_t>{32, 6, 4, 6});
+	}
+
+	TEST_CASE("Day 4")
+	{
+		const auto grid = parse_day4(utils::MappedFile(utils::abs_exe_directory() / "input" / "day4.full.txt").view());
+		const std::array words{"XMAS"sv, "MAS"sv, "SAMX"sv};
+		const auto counts = utils::WordSearch(words).count(grid);
+		CHECK(counts[0] == solve_day4(1, grid));
+		CHECK(counts[2] == counts[0]);
+	}
+}